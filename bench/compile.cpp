@@ -0,0 +1,316 @@
+#include <mcc/arena.hpp>
+#include <mcc/builder.hpp>
+#include <mcc/error.hpp>
+#include <mcc/package.hpp>
+#include <mcc/parse.hpp>
+#include <mcc/source.hpp>
+#include <mcc/tree.hpp>
+#include <mcc/type.hpp>
+#include <mcc/value.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <ranges>
+#include <set>
+#include <string>
+
+#ifdef __unix__
+#include <sys/resource.h>
+#endif
+
+struct Options
+{
+    unsigned long Files     = 100;
+    unsigned long Functions = 10;
+    unsigned long Depth     = 4;
+    unsigned long Overloads = 16;
+    unsigned long Elements  = 256;
+};
+
+static void write_file(
+        const std::filesystem::path &path,
+        const std::string &content)
+{
+    std::ofstream stream(path);
+    mcc::Assert(stream.is_open(), "failed to open file {}", path.string());
+    stream << content;
+}
+
+static std::string generate_operators(const Options &options)
+{
+    std::string source = "namespace bench\n\n";
+
+    for (unsigned long n = 1; n <= options.Overloads; ++n)
+    {
+        std::string elements, sum, scale;
+        for (unsigned long i = 0; i < n; ++i)
+        {
+            if (i)
+            {
+                elements += ", ";
+                sum += ", ";
+                scale += ", ";
+            }
+            elements += "number";
+            sum += std::format("a[{0}] + b[{0}]", i);
+            scale += std::format("a[{0}] * b", i);
+        }
+
+        source += std::format("type t{} = [{}]\n\n", n, elements);
+        source += std::format("define operator+(const &a: t{0}, const &b: t{0}): t{0} {{\n", n);
+        source += std::format("    return [{}]:t{}\n}}\n\n", sum, n);
+        source += std::format("define operator*(const &a: t{0}, b: number): t{0} {{\n", n);
+        source += std::format("    return [{}]:t{}\n}}\n\n", scale, n);
+    }
+
+    return source;
+}
+
+static std::string generate_tables(const Options &options)
+{
+    std::string source = "namespace bench\n\n";
+
+    for (unsigned long t = 0; t < 4; ++t)
+    {
+        source += std::format("define table{}(index: number): number {{\n    return [", t);
+        for (unsigned long i = 0; i < options.Elements; ++i)
+        {
+            if (i)
+                source += ", ";
+            source += std::to_string((i * 7919 + t * 104729) % 1000);
+        }
+        source += "][index]\n}\n\n";
+    }
+
+    return source;
+}
+
+static void generate_body(
+        std::string &source,
+        const unsigned long depth,
+        const unsigned long max_depth,
+        const unsigned long elements,
+        const unsigned long seed)
+{
+    const std::string indent(depth * 8 + 4, ' ');
+
+    if (depth == max_depth)
+    {
+        const auto n = seed % 4 + 1;
+        source += std::format("{}acc = acc + table{}(i{} % {})\n", indent, seed % 4, depth - 1, elements);
+        source += std::format("{0}v{1} = v{1} + v{1} * acc\n", indent, n);
+        return;
+    }
+
+    source += std::format("{0}for (let i{1} = 0, i{1} < n, ++i{1}) {{\n", indent, depth);
+    source += std::format("{}    if (i{} % {} == {}) {{\n", indent, depth, depth + 2, seed % (depth + 2));
+    generate_body(source, depth + 1, max_depth, elements, seed * 31 + 1);
+    source += std::format("{}    }} else {{\n", indent);
+    generate_body(source, depth + 1, max_depth, elements, seed * 17 + 3);
+    source += std::format("{}    }}\n", indent);
+    source += std::format("{}}}\n", indent);
+}
+
+static std::string generate_unit(
+        const Options &options,
+        const unsigned long index)
+{
+    std::string source = "include \"operators.mcc\"\ninclude \"tables.mcc\"\n\nnamespace bench\n\n";
+
+    for (unsigned long f = 0; f < options.Functions; ++f)
+    {
+        source += std::format("define f{}_{}(n: number): number {{\n", index, f);
+        source += "    let acc = 0\n";
+        for (unsigned long n = 1; n <= 4; ++n)
+        {
+            source += std::format("    let v{} = [", n);
+            for (unsigned long i = 0; i < n; ++i)
+                source += i ? ", 0" : "0";
+            source += std::format("]:t{}\n", n);
+        }
+
+        if (options.Depth)
+            generate_body(source, 0, options.Depth, options.Elements, index * options.Functions + f);
+
+        if (f)
+            source += std::format("    acc = acc + f{}_{}(n - 1)\n", index, f - 1);
+        source += "    return acc\n}\n\n";
+    }
+
+    return source;
+}
+
+static std::vector<std::filesystem::path> generate_corpus(
+        const std::filesystem::path &directory,
+        const Options &options)
+{
+    std::filesystem::create_directories(directory);
+
+    write_file(directory / "operators.mcc", generate_operators(options));
+    write_file(directory / "tables.mcc", generate_tables(options));
+
+    std::vector<std::filesystem::path> paths;
+    for (unsigned long i = 0; i < options.Files; ++i)
+    {
+        auto path = directory / std::format("unit{}.mcc", i);
+        write_file(path, generate_unit(options, i));
+        paths.push_back(std::move(path));
+    }
+    return paths;
+}
+
+static double seconds_since(const std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+static long peak_memory_kb()
+{
+#ifdef __unix__
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+// mcc_bench [<files>] [<functions per file>] [<nesting depth>] [<operator overloads>] [<table elements>] [<corpus directory>]
+//  -> generate a synthetic corpus and measure lex, parse, ir and codegen throughput and peak memory, the way a whole
+//     package compiles it
+int main(
+        const int argc,
+        const char **argv)
+{
+    Options options;
+    if (argc > 1)
+        options.Files = std::stoul(argv[1]);
+    if (argc > 2)
+        options.Functions = std::stoul(argv[2]);
+    if (argc > 3)
+        options.Depth = std::stoul(argv[3]);
+    if (argc > 4)
+        options.Overloads = std::max(std::stoul(argv[4]), 4ul);
+    if (argc > 5)
+        options.Elements = std::max(std::stoul(argv[5]), 1ul);
+
+    const std::filesystem::path directory = argc > 6
+                                                    ? std::filesystem::path(argv[6])
+                                                    : std::filesystem::temp_directory_path() / "mcc-bench";
+
+    const auto paths = generate_corpus(directory, options);
+
+    std::vector<mcc::SourceBuffer> sources;
+    size_t bytes = 0;
+    for (auto &path : paths)
+    {
+        auto &source = sources.emplace_back(path);
+        mcc::Assert(source.IsOpen(), "failed to open file {}", path.string());
+        bytes += source.Size();
+    }
+
+    size_t tokens = 0;
+    auto begin    = std::chrono::steady_clock::now();
+    {
+        mcc::Context context;
+        for (unsigned i = 0; i < paths.size(); ++i)
+        {
+            mcc::Parser parser(context, sources[i].View(), paths[i].string());
+            while (parser.Next().Type != mcc::TokenType::EoF)
+                ;
+            tokens += parser.Tokens();
+        }
+    }
+    const auto lex_seconds = seconds_since(begin);
+
+    const mcc::PackageInfo info{ .Name = "bench", .Description = {}, .Version = 71 };
+    mcc::Package package(info);
+
+    mcc::Context context;
+    mcc::IncludeCache includes;
+
+    mcc::StackIdSpace stack_ids;
+    const mcc::StackIdScope scope(stack_ids);
+
+    const auto arena = std::make_shared<mcc::Arena>();
+    const mcc::ArenaScope arena_scope(arena);
+
+    mcc::Builder builder(context, package, includes);
+
+    size_t nodes = 0;
+    begin        = std::chrono::steady_clock::now();
+
+    std::vector<std::vector<mcc::TreeNodePtr>> files;
+    for (unsigned i = 0; i < paths.size(); ++i)
+    {
+        context.ClearNamed();
+        builder.SetNamespace({});
+
+        std::set<std::filesystem::path> include_chain;
+        include_chain.insert(weakly_canonical(paths[i]));
+
+        auto &nodes_ = files.emplace_back();
+
+        mcc::Parser parser(context, sources[i].View(), paths[i].string());
+        while (parser)
+            if (auto node = parser())
+            {
+                node->GenerateInclude(builder, include_chain);
+                nodes_.emplace_back(std::move(node));
+            }
+
+        nodes += nodes_.size();
+    }
+    const auto parse_seconds = seconds_since(begin);
+
+    begin = std::chrono::steady_clock::now();
+    for (auto &nodes_ : files)
+    {
+        builder.SetNamespace({});
+        for (auto &node : nodes_)
+            node->Generate(builder);
+    }
+    const auto ir_seconds = seconds_since(begin);
+
+    begin = std::chrono::steady_clock::now();
+    builder.Generate();
+    const auto codegen_seconds = seconds_since(begin);
+
+    size_t commands = 0;
+    for (auto &function : package.Functions | std::views::values)
+        commands += std::ranges::count(function.Data(), '\n');
+
+    std::cout << std::format(
+            "corpus: {} files, {} bytes, {} functions per file, depth {}, {} overloads, {} table elements\n",
+            paths.size(),
+            bytes,
+            options.Functions,
+            options.Depth,
+            options.Overloads,
+            options.Elements);
+    std::cout << std::format(
+            "lex:     {:8.3f} s  {:12.0f} tokens/s  {:8.1f} MB/s\n",
+            lex_seconds,
+            static_cast<double>(tokens) / lex_seconds,
+            static_cast<double>(bytes) / lex_seconds / 1e6);
+    std::cout << std::format(
+            "parse:   {:8.3f} s  {:12.0f} nodes/s   {:8.1f} MB/s\n",
+            parse_seconds,
+            static_cast<double>(nodes) / parse_seconds,
+            static_cast<double>(bytes) / parse_seconds / 1e6);
+    std::cout << std::format(
+            "ir:      {:8.3f} s  {:12.0f} nodes/s\n",
+            ir_seconds,
+            static_cast<double>(nodes) / ir_seconds);
+    std::cout << std::format(
+            "codegen: {:8.3f} s  {:12.0f} commands/s, {} files, {} commands\n",
+            codegen_seconds,
+            static_cast<double>(commands) / codegen_seconds,
+            package.Functions.size(),
+            commands);
+    std::cout << std::format("peak memory: {} KB", peak_memory_kb()) << std::endl;
+
+    return 0;
+}
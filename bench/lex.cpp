@@ -0,0 +1,60 @@
+#include <mcc/error.hpp>
+#include <mcc/parse.hpp>
+#include <mcc/source.hpp>
+#include <mcc/type.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// mcc_lex_bench [<source directory>] [<scale>]
+//  -> concatenate every .mcc file in the source directory, repeat it <scale> times and measure lexing throughput
+int main(
+        const int argc,
+        const char **argv)
+{
+    const std::filesystem::path directory = argc > 1 ? argv[1] : "example/src";
+    const auto scale                      = argc > 2 ? std::stoul(argv[2]) : 1000ul;
+
+    std::string corpus;
+    for (auto &entry : std::filesystem::recursive_directory_iterator(directory))
+    {
+        if (entry.path().extension() != ".mcc")
+            continue;
+
+        const mcc::SourceBuffer source(entry.path());
+        mcc::Assert(source.IsOpen(), "failed to open file {}", entry.path().string());
+
+        corpus += source.View();
+        corpus += '\n';
+    }
+
+    std::string data;
+    data.reserve(corpus.size() * scale);
+    for (unsigned long i = 0; i < scale; ++i)
+        data += corpus;
+
+    mcc::Context context;
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    mcc::Parser parser(context, data, "<bench>");
+
+    size_t tokens = 1;
+    while (parser.Next().Type != mcc::TokenType::EoF)
+        ++tokens;
+
+    const auto end     = std::chrono::steady_clock::now();
+    const auto seconds = std::chrono::duration<double>(end - begin).count();
+
+    std::cout << std::format(
+            "{} bytes, {} tokens in {:.3f} s: {:.0f} tokens/s, {:.1f} MB/s",
+            data.size(),
+            tokens,
+            seconds,
+            static_cast<double>(tokens) / seconds,
+            static_cast<double>(data.size()) / seconds / 1e6)
+              << std::endl;
+
+    return 0;
+}
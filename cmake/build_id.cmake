@@ -0,0 +1,17 @@
+# cmake -DOUTPUT=<header> -DROOT=<source directory> -P build_id.cmake
+#  -> hash every compiler source into a header, so build caches from a different compiler are not reused
+
+file(GLOB_RECURSE FILES "${ROOT}/include/*.hpp" "${ROOT}/src/*.cpp")
+list(SORT FILES)
+
+set(CONTENT "")
+foreach (FILE IN LISTS FILES)
+    file(SHA256 "${FILE}" FILE_HASH)
+    string(APPEND CONTENT "${FILE_HASH}")
+endforeach ()
+string(SHA256 BUILD_ID "${CONTENT}")
+string(SUBSTRING "${BUILD_ID}" 0 16 BUILD_ID)
+
+file(WRITE "${OUTPUT}.tmp" "#pragma once\n\n#define MCC_BUILD_ID \"${BUILD_ID}\"\n")
+configure_file("${OUTPUT}.tmp" "${OUTPUT}" COPYONLY)
+file(REMOVE "${OUTPUT}.tmp")
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mcc
+{
+    /** nothing is freed before the arena itself; allocate from one thread at a time */
+    class Arena
+    {
+    public:
+        static const std::shared_ptr<Arena> &Current();
+
+        Arena() = default;
+
+        Arena(const Arena &)            = delete;
+        Arena &operator=(const Arena &) = delete;
+
+        void *Allocate(
+                size_t size,
+                size_t alignment);
+
+        template<typename T, typename... Args>
+        T *New(Args &&... args)
+        {
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+    private:
+        std::vector<std::unique_ptr<std::byte[]>> m_Blocks;
+        std::byte *m_Head = nullptr;
+        std::byte *m_End  = nullptr;
+    };
+
+    class ArenaScope
+    {
+    public:
+        explicit ArenaScope(std::shared_ptr<Arena> arena);
+        ~ArenaScope();
+
+        ArenaScope(const ArenaScope &)            = delete;
+        ArenaScope &operator=(const ArenaScope &) = delete;
+
+    private:
+        std::shared_ptr<Arena> m_Previous;
+    };
+
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(std::shared_ptr<Arena> arena)
+            : m_Arena(std::move(arena))
+        {
+        }
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U> &other) // NOLINT(*-explicit-constructor)
+            : m_Arena(other.GetArena())
+        {
+        }
+
+        T *allocate(const size_t count)
+        {
+            return static_cast<T *>(m_Arena->Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *, size_t)
+        {
+        }
+
+        [[nodiscard]] const std::shared_ptr<Arena> &GetArena() const
+        {
+            return m_Arena;
+        }
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U> &other) const
+        {
+            return m_Arena == other.GetArena();
+        }
+
+    private:
+        std::shared_ptr<Arena> m_Arena;
+    };
+
+    struct NodeDeleter
+    {
+        template<typename T>
+        void operator()(T *node) const
+        {
+            std::destroy_at(node);
+        }
+    };
+
+    template<typename T>
+    using NodePtr = std::unique_ptr<T, NodeDeleter>;
+
+    template<typename T, typename... Args>
+    NodePtr<T> MakeNode(Args &&... args)
+    {
+        return NodePtr<T>(Arena::Current()->New<T>(std::forward<Args>(args)...));
+    }
+
+    template<typename T, typename... Args>
+    std::shared_ptr<T> MakeValue(Args &&... args)
+    {
+        return std::allocate_shared<T>(ArenaAllocator<T>(Arena::Current()), std::forward<Args>(args)...);
+    }
+}
@@ -4,16 +4,24 @@
 #include <mcc/module.hpp>
 #include <mcc/package.hpp>
 
+#include <set>
+#include <unordered_map>
+
 namespace mcc
 {
     class Builder
     {
     public:
         Builder(Context &context,
-                Package &package);
+                Package &package,
+                IncludeCache &includes);
 
         [[nodiscard]] Context &GetContext() const;
         [[nodiscard]] Package &GetPackage() const;
+        [[nodiscard]] IncludeCache &GetIncludes() const;
+
+        void AddDependency(const std::filesystem::path &path);
+        [[nodiscard]] const std::set<std::filesystem::path> &GetDependencies() const;
 
         [[nodiscard]] std::string GetNamespace() const;
         void SetNamespace(const std::string &namespace_);
@@ -215,11 +223,13 @@ namespace mcc
     private:
         Context &m_Context;
         Package &m_Package;
+        IncludeCache &m_Includes;
+        std::set<std::filesystem::path> m_Dependencies;
 
         Module m_Module;
 
         std::string m_Namespace;
-        std::map<std::string, std::map<std::vector<std::string>, ValuePtr>> m_Globals;
+        std::unordered_map<ResourceId, ValuePtr> m_Globals;
 
         BlockPtr m_InsertBlock;
         std::vector<std::map<std::string, ValuePtr>> m_Variables;
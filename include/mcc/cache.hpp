@@ -0,0 +1,41 @@
+#pragma once
+
+#include <mcc/common.hpp>
+#include <mcc/package.hpp>
+#include <mcc/value.hpp>
+
+#include <string_view>
+
+namespace mcc
+{
+    using HashT = uint64_t;
+
+    HashT Hash(std::string_view data);
+
+    struct CacheEntry
+    {
+        HashT Source = 0;
+        std::map<std::filesystem::path, HashT> Includes;
+        StackIdSpace StackIds;
+    };
+
+    class BuildCache
+    {
+    public:
+        explicit BuildCache(std::filesystem::path directory);
+
+        [[nodiscard]] bool Load(
+                const std::filesystem::path &source,
+                CacheEntry &entry,
+                Package &package) const;
+        void Store(
+                const std::filesystem::path &source,
+                const CacheEntry &entry,
+                const Package &package) const;
+
+    private:
+        [[nodiscard]] std::filesystem::path GetEntryPath(const std::filesystem::path &source) const;
+
+        std::filesystem::path m_Directory;
+    };
+}
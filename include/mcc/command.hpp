@@ -2,19 +2,67 @@
 
 #include <mcc/common.hpp>
 
+#include <iterator>
+#include <string_view>
+
 namespace mcc
 {
+    class CommandBuffer
+    {
+    public:
+        void Append(const std::string_view command)
+        {
+            m_Data += command;
+            m_Data += '\n';
+        }
+
+        template<typename... Args>
+        void Append(
+                std::format_string<Args...> format,
+                Args &&...args)
+        {
+            std::format_to(std::back_inserter(m_Data), std::move(format), std::forward<Args>(args)...);
+            m_Data += '\n';
+        }
+
+        void Append(const CommandBuffer &other)
+        {
+            m_Data += other.m_Data;
+        }
+
+        [[nodiscard]] bool Empty() const
+        {
+            return m_Data.empty();
+        }
+
+        [[nodiscard]] const std::string &Data() const
+        {
+            return m_Data;
+        }
+
+        std::string &Data()
+        {
+            return m_Data;
+        }
+
+        bool operator==(const CommandBuffer &other) const = default;
+
+    private:
+        std::string m_Data;
+    };
+
     class CommandVector
     {
     public:
-        explicit CommandVector(std::vector<CommandT> &commands)
+        explicit CommandVector(CommandBuffer &commands)
             : m_Commands(commands)
         {
         }
 
-        CommandVector &Append(CommandT command)
+        CommandVector &Append(const std::string_view command)
         {
-            m_Commands.push_back(std::move(command));
+            m_Commands.Append(command);
+            ++m_Count;
             return *this;
         }
 
@@ -23,11 +71,18 @@ namespace mcc
                 std::format_string<Args...> format,
                 Args &&...args)
         {
-            m_Commands.push_back(std::format(std::move(format), std::forward<Args>(args)...));
+            m_Commands.Append(std::move(format), std::forward<Args>(args)...);
+            ++m_Count;
             return *this;
         }
 
+        [[nodiscard]] size_t Count() const
+        {
+            return m_Count;
+        }
+
     private:
-        std::vector<CommandT> &m_Commands;
+        CommandBuffer &m_Commands;
+        size_t m_Count = 0;
     };
 }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <mcc/arena.hpp>
 #include <mcc/enums.hpp>
 
+#include <cstdint>
 #include <filesystem>
 #include <format>
 #include <memory>
@@ -15,20 +17,24 @@ namespace mcc
     using IndexT   = unsigned long long;
     using CommandT = std::string;
 
+    /** created once by <package name>:__load, if any function uses it */
+    constexpr auto RegisterObjective = "mcc";
+
     class Context;
     class Parser;
     class Builder;
     class CommandVector;
+    class IncludeCache;
 
     struct TreeNode;
     struct Statement;
     struct Expression;
     struct FormatNode;
 
-    using TreeNodePtr   = std::unique_ptr<TreeNode>;
-    using StatementPtr  = std::unique_ptr<Statement>;
-    using ExpressionPtr = std::unique_ptr<Expression>;
-    using FormatNodePtr = std::unique_ptr<FormatNode>;
+    using TreeNodePtr   = NodePtr<TreeNode>;
+    using StatementPtr  = NodePtr<Statement>;
+    using ExpressionPtr = NodePtr<Expression>;
+    using FormatNodePtr = NodePtr<FormatNode>;
 
     struct ValueBase;
     struct Constant;
@@ -42,7 +48,6 @@ namespace mcc
     struct Value;
 
     using ValuePtr       = std::shared_ptr<ValueBase>;
-    using WeakValuePtr   = std::weak_ptr<ValueBase>;
     using ConstantPtr    = std::shared_ptr<Constant>;
     using InstructionPtr = std::shared_ptr<Instruction>;
     using BlockPtr       = std::shared_ptr<Block>;
@@ -79,9 +84,20 @@ namespace mcc
         unsigned Flags = 0;
     };
 
+    using FileId = std::uint32_t;
+
+    class FileTable
+    {
+    public:
+        static FileId Intern(const std::string &filename);
+
+        static const std::string &GetFilename(FileId id);
+        static const std::string &GetCanonical(FileId id);
+    };
+
     struct SourceLocation
     {
-        std::string Filename;
+        FileId File  = 0;
         unsigned Row = 0;
         unsigned Col = 0;
     };
@@ -144,7 +160,7 @@ struct std::formatter<mcc::SourceLocation>
         return std::format_to(
                 ctx.out(),
                 "{}:{}:{}",
-                std::filesystem::canonical(where.Filename).string(),
+                mcc::FileTable::GetCanonical(where.File),
                 where.Row,
                 where.Col);
     }
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <mcc/builder.hpp>
+#include <mcc/cache.hpp>
+#include <mcc/common.hpp>
+#include <mcc/package.hpp>
+#include <mcc/tree.hpp>
+#include <mcc/type.hpp>
+
+#include <deque>
+#include <exception>
+
+namespace mcc
+{
+    class Compiler
+    {
+    public:
+        Compiler(
+                const PackageInfo &info,
+                unsigned jobs,
+                std::filesystem::path cache_directory);
+
+        /** returns the number of files that had to be recompiled */
+        size_t Compile(
+                Package &package,
+                const std::vector<std::filesystem::path> &paths);
+
+        void CompileWhole(
+                Package &package,
+                const std::vector<std::filesystem::path> &paths);
+
+        void Invalidate(const std::filesystem::path &path);
+
+    private:
+        struct Unit
+        {
+            Unit(
+                    const PackageInfo &info,
+                    std::filesystem::path path);
+
+            std::filesystem::path Path;
+            Package Output;
+            StackIdSpace StackIds;
+            std::shared_ptr<mcc::Arena> Arena;
+            std::unique_ptr<mcc::Builder> Builder;
+            std::exception_ptr Exception;
+
+            CacheEntry Entry;
+            bool Known  = false;
+            bool Cached = false;
+        };
+
+        struct Worker
+        {
+            mcc::Context Context;
+            IncludeCache Includes;
+            std::vector<Unit *> Units;
+        };
+
+        HashT HashFile(const std::filesystem::path &path);
+
+        void Check(Unit &unit);
+        void Lower(
+                Worker &worker,
+                Unit &unit) const;
+        static void Generate(Unit &unit);
+
+        void AllocateStackIds();
+
+        template<typename F>
+        void RunWorkers(F &&task);
+
+        const PackageInfo &m_Info;
+        BuildCache m_Cache;
+        std::map<std::filesystem::path, HashT> m_Hashes;
+
+        // destroyed after the units, whose builders refer to their contexts
+        std::vector<Worker> m_Workers;
+        std::map<std::filesystem::path, Unit> m_Units;
+        std::vector<Unit *> m_Order;
+    };
+}
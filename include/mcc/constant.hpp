@@ -33,11 +33,10 @@ namespace mcc
                 const TypePtr &type,
                 const std::vector<ConstantPtr> &values,
                 bool stringify);
-        ~ConstantArray() override;
 
         [[nodiscard]] Result GenerateResult() const override;
 
-        std::vector<ConstantPtr> Values;
+        std::vector<Operand<Constant>> Values;
         bool Stringify;
     };
 
@@ -82,11 +81,10 @@ namespace mcc
                         std::string,
                         ConstantPtr
                 > &values);
-        ~ConstantObject() override;
 
         [[nodiscard]] Result GenerateResult() const override;
 
-        std::map<std::string, ConstantPtr> Values;
+        std::map<std::string, Operand<Constant>> Values;
     };
 
     struct ConstantResource final : Constant
@@ -58,6 +58,7 @@ namespace mcc
         Value,
         Reference,
         Argument,
+        Score,
     };
 
     enum class FieldType_
@@ -188,6 +189,7 @@ namespace mcc
             {     ResultType_::Value,     "value" },
             { ResultType_::Reference, "reference" },
             {  ResultType_::Argument,  "argument" },
+            {     ResultType_::Score,     "score" },
         };
 
         return map.at(val);
@@ -2,6 +2,10 @@
 
 #include <mcc/value.hpp>
 
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace mcc
 {
     struct Function final : Value<Function>
@@ -41,12 +45,20 @@ namespace mcc
                 std::string &prefix,
                 std::string &arguments) const;
 
-        [[nodiscard]] ResourceLocation Mangle() const;
+        [[nodiscard]] const ResourceLocation &Mangle() const;
+        [[nodiscard]] ResourceId GetMangledId() const;
 
         [[nodiscard]] ResourceLocation GetLocation(const BlockPtr &target_block) const;
 
         BlockPtr Erase(const BlockPtr &target_block);
 
+        [[nodiscard]] std::optional<std::string> GetRegister(const ValueBase *value) const;
+        [[nodiscard]] bool IsFusedCondition(const ValueBase *value) const;
+
+        void Memoize();
+        /** must be called whenever blocks or their instructions change */
+        void Invalidate();
+
         Module &ModuleRef;
         ResourceLocation Location;
         ParameterList Parameters;
@@ -55,5 +67,19 @@ namespace mcc
 
         IndexT StackIndex{};
         std::vector<BlockPtr> Blocks;
+
+        std::vector<BlockPtr> ErasedBlocks;
+
+    private:
+        void FuseConditions();
+        void AllocateRegisters();
+
+        mutable std::optional<ResourceId> m_MangledId;
+
+        bool m_Memoized     = false;
+        bool m_RequireStack = false;
+        std::unordered_map<const Block *, ResourceLocation> m_Locations;
+        std::unordered_map<const ValueBase *, unsigned> m_Registers;
+        std::unordered_set<const ValueBase *> m_FusedConditions;
     };
 }
@@ -17,9 +17,6 @@ namespace mcc
 
         [[nodiscard]] std::string GetStackPath() const;
         [[nodiscard]] std::string GetTemp() const;
-
-        [[nodiscard]] std::string CreateScore() const;
-        [[nodiscard]] std::string RemoveScore() const;
     };
 
     struct ArrayInstruction final : Instruction
@@ -61,7 +58,6 @@ namespace mcc
                 ValuePtr array,
                 ValuePtr value,
                 IndexT index);
-        ~ArrayInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -70,7 +66,7 @@ namespace mcc
         [[nodiscard]] bool RequireStack() const override;
 
         ArrayOperation_ ArrayOperation;
-        ValuePtr Array, Value;
+        Operand<ValueBase> Array, Value;
         IndexT Index;
     };
 
@@ -93,7 +89,6 @@ namespace mcc
                 ValuePtr condition,
                 BlockPtr then_target,
                 BlockPtr else_target);
-        ~BranchInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -104,8 +99,8 @@ namespace mcc
         [[nodiscard]] bool IsTerminator() const override;
 
         FunctionPtr Parent;
-        ValuePtr Condition;
-        BlockPtr ThenTarget, ElseTarget;
+        Operand<ValueBase> Condition;
+        Operand<Block> ThenTarget, ElseTarget;
     };
 
     struct CallInstruction final : Instruction
@@ -131,7 +126,6 @@ namespace mcc
                         ValuePtr
                 >> &arguments,
                 BlockPtr landing_pad);
-        ~CallInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -142,8 +136,8 @@ namespace mcc
 
         FunctionPtr Parent;
         FunctionPtr Callee;
-        std::vector<std::pair<std::string, ValuePtr>> Arguments;
-        BlockPtr LandingPad;
+        std::vector<std::pair<std::string, Operand<ValueBase>>> Arguments;
+        Operand<Block> LandingPad;
     };
 
     struct CommandInstruction final : Instruction
@@ -192,7 +186,6 @@ namespace mcc
                 FunctionPtr parent,
                 ValuePtr left,
                 ValuePtr right);
-        ~ComparisonInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -201,9 +194,14 @@ namespace mcc
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
+        /** prefix is set to '$' if the returned subcommand expands an argument */
+        [[nodiscard]] std::string GenerateCondition(
+                CommandVector &commands,
+                std::string &prefix) const;
+
         Comparator_ Comparator;
         FunctionPtr Parent;
-        ValuePtr Left, Right;
+        Operand<ValueBase> Left, Right;
     };
 
     struct DeleteInstruction final : Instruction
@@ -219,7 +217,6 @@ namespace mcc
                 const std::string &name,
                 Context &context,
                 ValuePtr value);
-        ~DeleteInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -227,7 +224,7 @@ namespace mcc
 
         [[nodiscard]] bool RequireStack() const override;
 
-        ValuePtr Value;
+        Operand<ValueBase> Value;
     };
 
     struct DirectBranchInstruction final : Instruction
@@ -255,7 +252,6 @@ namespace mcc
                 BlockPtr target,
                 ValuePtr result,
                 ValuePtr branch_result);
-        ~DirectBranchInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -266,8 +262,8 @@ namespace mcc
         [[nodiscard]] bool IsTerminator() const override;
 
         FunctionPtr Parent;
-        BlockPtr Target;
-        ValuePtr Result, BranchResult;
+        Operand<Block> Target;
+        Operand<ValueBase> Result, BranchResult;
     };
 
     struct MacroInstruction final : Instruction
@@ -287,7 +283,6 @@ namespace mcc
                 FunctionPtr parent,
                 std::string macro,
                 const std::vector<ValuePtr> &arguments);
-        ~MacroInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -297,7 +292,7 @@ namespace mcc
 
         FunctionPtr Parent;
         std::string Macro;
-        std::vector<ValuePtr> Arguments;
+        std::vector<Operand<ValueBase>> Arguments;
     };
 
     struct NotNullInstruction final : Instruction
@@ -315,7 +310,6 @@ namespace mcc
                 Context &context,
                 FunctionPtr parent,
                 ValuePtr value);
-        ~NotNullInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -325,7 +319,7 @@ namespace mcc
         [[nodiscard]] Result GenerateResult() const override;
 
         FunctionPtr Parent;
-        ValuePtr Value;
+        Operand<ValueBase> Value;
     };
 
     struct ObjectInstruction final : Instruction
@@ -345,7 +339,6 @@ namespace mcc
                 ValuePtr object,
                 ValuePtr value,
                 std::string key);
-        ~ObjectInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -353,7 +346,7 @@ namespace mcc
 
         [[nodiscard]] bool RequireStack() const override;
 
-        ValuePtr Object, Value;
+        Operand<ValueBase> Object, Value;
         std::string Key;
     };
 
@@ -374,7 +367,6 @@ namespace mcc
                 Operator_ operator_,
                 FunctionPtr parent,
                 const std::vector<ValuePtr> &operands);
-        ~OperationInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -385,7 +377,7 @@ namespace mcc
 
         Operator_ Operator;
         FunctionPtr Parent;
-        std::vector<ValuePtr> Operands;
+        std::vector<Operand<ValueBase>> Operands;
     };
 
     struct ReturnInstruction final : Instruction
@@ -403,7 +395,6 @@ namespace mcc
                 Context &context,
                 FunctionPtr parent,
                 ValuePtr value);
-        ~ReturnInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -414,7 +405,7 @@ namespace mcc
         [[nodiscard]] bool IsTerminator() const override;
 
         FunctionPtr Parent;
-        ValuePtr Value;
+        Operand<ValueBase> Value;
     };
 
     struct StoreInstruction final : Instruction
@@ -430,7 +421,6 @@ namespace mcc
                 const std::string &name,
                 const ValuePtr &dst,
                 ValuePtr src);
-        ~StoreInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -439,7 +429,7 @@ namespace mcc
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr Dst, Src;
+        Operand<ValueBase> Dst, Src;
     };
 
     struct SwitchInstruction final : Instruction
@@ -461,24 +451,21 @@ namespace mcc
                 ValuePtr condition,
                 BlockPtr default_target,
                 CaseTargetMap case_targets);
-        ~SwitchInstruction() override;
 
         void Generate(
                 CommandVector &commands,
                 bool stack) const override;
 
+        void GenerateDispatch(Package &package) const;
+
         [[nodiscard]] bool RequireStack() const override;
 
         [[nodiscard]] bool IsTerminator() const override;
 
-        void Replace(
-                ValuePtr value,
-                ValuePtr replacement) override;
-
         FunctionPtr Parent;
-        ValuePtr Condition;
-        BlockPtr DefaultTarget;
-        CaseTargetMap CaseTargets;
+        Operand<ValueBase> Condition;
+        Operand<Block> DefaultTarget;
+        std::vector<std::pair<Operand<Constant>, Operand<Block>>> CaseTargets;
     };
 
     struct ThrowInstruction final : Instruction
@@ -498,7 +485,6 @@ namespace mcc
                 FunctionPtr parent,
                 ValuePtr value,
                 BlockPtr landing_pad);
-        ~ThrowInstruction() override;
 
         void Generate(
                 CommandVector &commands,
@@ -509,7 +495,7 @@ namespace mcc
         [[nodiscard]] bool IsTerminator() const override;
 
         FunctionPtr Parent;
-        ValuePtr Value;
-        BlockPtr LandingPad;
+        Operand<ValueBase> Value;
+        Operand<Block> LandingPad;
     };
 }
@@ -2,8 +2,15 @@
 
 #include <mcc/common.hpp>
 
+#include <deque>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+
 namespace mcc
 {
+    using SymbolT = unsigned;
+
     enum class TokenType
     {
         EoF,
@@ -16,13 +23,114 @@ namespace mcc
         Undefined,
     };
 
+    /** every keyword's symbol id equals its enum value */
+    enum class Keyword : SymbolT
+    {
+        None,
+        Array,
+        Block,
+        Break,
+        Case,
+        Catch,
+        Const,
+        ConstExpr,
+        Continue,
+        Default,
+        Define,
+        Delete,
+        Else,
+        Entity,
+        For,
+        ForEach,
+        Function,
+        Global,
+        If,
+        Include,
+        Let,
+        Namespace,
+        Number,
+        Object,
+        Operator,
+        Ref,
+        Return,
+        Storage,
+        String,
+        Switch,
+        Throw,
+        Throws,
+        Try,
+        Type,
+        Unless,
+        Void,
+    };
+
+    constexpr std::string_view KeywordNames[]{
+        "",
+        "array",
+        "block",
+        "break",
+        "case",
+        "catch",
+        "const",
+        "constexpr",
+        "continue",
+        "default",
+        "define",
+        "delete",
+        "else",
+        "entity",
+        "for",
+        "foreach",
+        "function",
+        "global",
+        "if",
+        "include",
+        "let",
+        "namespace",
+        "number",
+        "object",
+        "operator",
+        "ref",
+        "return",
+        "storage",
+        "string",
+        "switch",
+        "throw",
+        "throws",
+        "try",
+        "type",
+        "unless",
+        "void",
+    };
+
+    static_assert(std::size(KeywordNames) == static_cast<SymbolT>(Keyword::Void) + 1);
+
+    inline const char *ToString(const Keyword val)
+    {
+        return KeywordNames[static_cast<SymbolT>(val)].data();
+    }
+
     struct Token
     {
         TokenType Type;
         SourceLocation Where;
-        std::string Raw;
-        std::string Value;
+        std::string_view Raw;
+        std::string_view Value;
         IndexT Number = 0;
+        SymbolT Symbol = 0;
+    };
+
+    class SymbolTable
+    {
+    public:
+        SymbolTable();
+
+        SymbolT Intern(std::string_view name);
+        [[nodiscard]] std::string_view Get(SymbolT symbol) const;
+
+    private:
+        std::deque<std::string> m_Names;
+        std::unordered_map<std::string_view, SymbolT> m_Symbols;
     };
 }
 
@@ -53,4 +161,16 @@ namespace std
             return formatter<string>::format("<undefined>", ctx);
         }
     };
+
+    template<>
+    struct formatter<mcc::Keyword> : formatter<string>
+    {
+        template<typename FormatContext>
+        auto format(
+                const mcc::Keyword &val,
+                FormatContext &ctx) const
+        {
+            return formatter<string>::format(mcc::ToString(val), ctx);
+        }
+    };
 }
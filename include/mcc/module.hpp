@@ -3,6 +3,7 @@
 #include <mcc/common.hpp>
 #include <mcc/resource.hpp>
 
+#include <unordered_map>
 #include <vector>
 
 namespace mcc
@@ -16,6 +17,10 @@ namespace mcc
                 const ParameterList &parameters);
 
         explicit Module(Context &context);
+        ~Module();
+
+        Module(const Module &)            = delete;
+        Module &operator=(const Module &) = delete;
 
         [[nodiscard]] Context &GetContext() const;
 
@@ -33,11 +38,16 @@ namespace mcc
                 const ResourceLocation &location,
                 const ParameterList &parameters) const;
 
+        [[nodiscard]] const std::vector<FunctionPtr> &GetOverloads(const ResourceLocation &location) const;
+        [[nodiscard]] const std::vector<FunctionPtr> &GetOverloads(const std::vector<std::string> &path) const;
+
         ResourceLocation Mangle(const FunctionPtr &function) const;
 
     private:
         Context &m_Context;
 
         std::vector<FunctionPtr> m_Functions;
+        std::unordered_map<ResourceLocation, std::vector<FunctionPtr>> m_Locations;
+        std::unordered_map<std::vector<std::string>, std::vector<FunctionPtr>, PathHash> m_Paths;
     };
 }
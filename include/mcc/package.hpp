@@ -1,24 +1,32 @@
 #pragma once
 
+#include <mcc/command.hpp>
 #include <mcc/common.hpp>
 #include <mcc/resource.hpp>
+#include <mcc/zip.hpp>
 
 #include <json/json.hxx>
 
+#include <unordered_map>
+
 namespace mcc
 {
-    using FunctionInfo = std::vector<CommandT>;
+    using FunctionInfo = CommandBuffer;
 
     struct Tag
     {
-        ResourceLocation Location;
+        ResourceId Location;
         bool Required = true;
+
+        bool operator==(const Tag &other) const = default;
     };
 
     struct TagInfo
     {
         bool Replace = false;
         std::vector<Tag> Values;
+
+        bool operator==(const TagInfo &other) const = default;
     };
 
     struct PackageInfo
@@ -36,22 +44,26 @@ namespace mcc
     {
         explicit Package(const PackageInfo &info);
 
-        void Write(const std::filesystem::path &path) const;
+        void Merge(const Package &other);
+        void AddLoadFunction();
+        void Write(
+                const std::filesystem::path &path,
+                unsigned jobs) const;
+        void Pack(
+                const std::filesystem::path &destination,
+                ZipMethod_ method,
+                unsigned jobs) const;
+        void WriteChanges(
+                const std::filesystem::path &path,
+                const Package &previous,
+                unsigned jobs) const;
 
         const PackageInfo &Info;
-        std::map<std::string, std::map<std::vector<std::string>, FunctionInfo>> Functions;
-        std::map<std::string, std::map<std::vector<std::string>, TagInfo>> Tags;
+        std::unordered_map<ResourceId, FunctionInfo> Functions;
+        std::unordered_map<ResourceId, TagInfo> Tags;
     };
 }
 
-template<>
-struct data::serializer<mcc::ResourceLocation>
-{
-    static void to_data(
-            json::Node &node,
-            const mcc::ResourceLocation &value);
-};
-
 template<>
 struct data::serializer<mcc::Tag>
 {
@@ -4,32 +4,40 @@
 #include <mcc/lex.hpp>
 #include <mcc/resource.hpp>
 
+#include <initializer_list>
+#include <map>
+#include <string_view>
+
 namespace mcc
 {
     class Parser
     {
     public:
         Parser(Context &context,
-               std::istream &stream,
+               std::string_view source,
                const std::string &filename);
         Parser(Context &context,
-               std::istream &stream,
+               std::string_view source,
                SourceLocation location);
 
         [[nodiscard]] size_t Count() const;
+        [[nodiscard]] size_t Tokens() const;
+        [[nodiscard]] const std::map<std::string, TypePtr> &GetNamedLookups() const;
 
         explicit operator bool() const;
         TreeNodePtr operator()();
 
+        Token &Next();
+
     private:
         void Get();
-        Token &Next();
 
         [[nodiscard]] bool At(
                 TokenType type,
-                const std::string &value = {}) const;
-        [[nodiscard]] bool AtAny(const std::vector<TokenType> &types) const;
-        [[nodiscard]] bool AtEnum(const std::vector<const char *> &values) const;
+                std::string_view value = {}) const;
+        [[nodiscard]] bool At(Keyword keyword) const;
+        [[nodiscard]] bool AtAny(std::initializer_list<TokenType> types) const;
+        [[nodiscard]] bool AtEnum(std::initializer_list<Keyword> keywords) const;
 
         template<typename... Args>
         [[nodiscard]] bool AtEnum(Args &&...args) const
@@ -45,14 +53,16 @@ namespace mcc
 
         bool SkipIf(
                 TokenType type,
-                const std::string &value = {});
+                std::string_view value = {});
+        bool SkipIf(Keyword keyword);
 
         Token Skip();
         Token Expect(
                 TokenType type,
-                std::string value = {});
-        Token ExpectAny(const std::vector<TokenType> &types);
-        Token ExpectEnum(const std::vector<const char *> &values);
+                std::string_view value = {});
+        Token Expect(Keyword keyword);
+        Token ExpectAny(std::initializer_list<TokenType> types);
+        Token ExpectEnum(std::initializer_list<Keyword> keywords);
 
         template<typename... Args>
         Token ExpectEnum(Args &&...args)
@@ -114,12 +124,15 @@ namespace mcc
 
         Context &m_Context;
 
-        std::istream &m_Stream;
+        std::string_view m_Source;
 
         int m_Buf = -1;
         SourceLocation m_Where;
         Token m_Token;
 
-        size_t m_Count = 0;
+        size_t m_Count  = 0;
+        size_t m_Tokens = 0;
+
+        std::map<std::string, TypePtr> m_NamedLookups;
     };
 }
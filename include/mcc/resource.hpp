@@ -2,6 +2,7 @@
 
 #include <mcc/common.hpp>
 
+#include <cstdint>
 #include <filesystem>
 #include <sstream>
 
@@ -74,9 +75,18 @@ namespace mcc
 
         [[nodiscard]] std::string String() const
         {
-            std::ostringstream stream;
-            Print(stream);
-            return stream.str();
+            std::string string;
+            if (TAG)
+                string += '#';
+            string += Namespace;
+            string += ':';
+            for (auto it = Path.begin(); it != Path.end(); ++it)
+            {
+                if (it != Path.begin())
+                    string += '/';
+                string += *it;
+            }
+            return string;
         }
 
         bool operator==(const Resource &other) const
@@ -98,6 +108,29 @@ namespace mcc
     using ResourceLocation = Resource<false>;
     using ResourceTag      = Resource<true>;
 
+    struct PathHash
+    {
+        size_t operator()(const std::vector<std::string> &path) const
+        {
+            size_t hash = path.size();
+            for (auto &segment : path)
+                hash ^= std::hash<std::string>()(segment) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    using ResourceId = std::uint32_t;
+
+    /** ids are only meaningful within one process */
+    class ResourceTable
+    {
+    public:
+        static ResourceId Intern(const ResourceLocation &location);
+
+        static const ResourceLocation &Get(ResourceId id);
+        static const std::string &GetString(ResourceId id);
+    };
+
     template<bool TAG>
     std::ostream &operator<<(
             std::ostream &stream,
@@ -123,6 +156,15 @@ namespace mcc
 
 namespace std
 {
+    template<bool TAG>
+    struct hash<mcc::Resource<TAG>>
+    {
+        size_t operator()(const mcc::Resource<TAG> &resource) const noexcept
+        {
+            return hash<string>()(resource.Namespace) ^ mcc::PathHash()(resource.Path) << 1;
+        }
+    };
+
     template<>
     struct formatter<mcc::ResourceLocation> : formatter<string>
     {
@@ -23,5 +23,10 @@ namespace mcc
 
         /* Argument */
         std::string Name;
+
+        /* Score */
+        std::string Player;
+        std::string Objective;
+        std::string StoreType;
     };
 }
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <mcc/common.hpp>
+
+#include <string_view>
+
+namespace mcc
+{
+    class SourceBuffer
+    {
+    public:
+        SourceBuffer() = default;
+        explicit SourceBuffer(const std::filesystem::path &path);
+        explicit SourceBuffer(std::string data);
+
+        [[nodiscard]] bool IsOpen() const;
+
+        [[nodiscard]] const char *Data() const;
+        [[nodiscard]] size_t Size() const;
+        [[nodiscard]] std::string_view View() const;
+
+    private:
+        bool m_Open = false;
+        std::string m_Data;
+    };
+}
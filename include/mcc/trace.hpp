@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace mcc
+{
+    class Trace
+    {
+    public:
+        static void Enable();
+        [[nodiscard]] static bool IsEnabled();
+
+        static void Write(const std::filesystem::path &path);
+    };
+
+    class TraceSpan
+    {
+    public:
+        explicit TraceSpan(std::string_view name);
+        ~TraceSpan();
+
+        TraceSpan(const TraceSpan &)            = delete;
+        TraceSpan &operator=(const TraceSpan &) = delete;
+
+        explicit operator bool() const;
+
+        TraceSpan &Arg(
+                std::string_view key,
+                std::uint64_t value);
+        TraceSpan &Arg(
+                std::string_view key,
+                std::string_view value);
+
+    private:
+        bool m_Enabled;
+        std::string m_Name;
+        std::string m_Args;
+        std::chrono::steady_clock::time_point m_Begin;
+    };
+}
@@ -3,6 +3,7 @@
 #include <mcc/common.hpp>
 #include <mcc/resource.hpp>
 
+#include <map>
 #include <set>
 
 namespace mcc
@@ -97,4 +98,46 @@ namespace mcc
 
         std::string Namespace;
     };
+
+    struct TypeNode final : TreeNode
+    {
+        TypeNode(
+                const SourceLocation &where,
+                std::string name,
+                TypePtr type);
+
+        std::ostream &Print(std::ostream &stream) const override;
+        void Generate(Builder &builder) const override;
+        void GenerateInclude(
+                Builder &builder,
+                std::set<std::filesystem::path> &include_chain) const override;
+
+        std::string Name;
+        TypePtr Type;
+    };
+
+    class IncludeCache
+    {
+    public:
+        [[nodiscard]] const std::vector<TreeNodePtr> *Find(
+                const std::filesystem::path &path,
+                const Context &context) const;
+        void Insert(
+                const std::filesystem::path &path,
+                std::map<std::string, TypePtr> imports,
+                std::shared_ptr<Arena> arena,
+                std::vector<TreeNodePtr> nodes);
+        void Erase(const std::filesystem::path &path);
+
+    private:
+        struct Entry
+        {
+            // named types resolved from the includer; the nodes are only reused while these resolve the same
+            std::map<std::string, TypePtr> Imports;
+            std::shared_ptr<mcc::Arena> Arena;
+            std::vector<TreeNodePtr> Nodes;
+        };
+
+        std::map<std::filesystem::path, std::vector<Entry>> m_Entries;
+    };
 }
@@ -1,17 +1,28 @@
 #pragma once
 
 #include <mcc/common.hpp>
+#include <mcc/lex.hpp>
 
+#include <cstdint>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 namespace mcc
 {
+    using TypeId = std::uint32_t;
+
     bool SameOrSpecialization(
             const TypePtr &a,
             const TypePtr &b);
 
+    struct TypeKeyHash
+    {
+        size_t operator()(const std::vector<TypeId> &key) const;
+        size_t operator()(const std::vector<std::pair<std::string, TypeId>> &key) const;
+    };
+
     class Context
     {
     public:
@@ -40,17 +51,34 @@ namespace mcc
         TypePtr SetNamed(
                 const std::string &name,
                 const TypePtr &type);
+        [[nodiscard]] const std::map<std::string, TypePtr> &GetNamedTypes() const;
         [[nodiscard]] TypePtr GetNamed(const std::string &name) const;
+        void ClearNamed();
+
+        SymbolTable &GetSymbols();
+
+        bool HasSpecialization(
+                const TypePtr &type,
+                const TypePtr &other);
 
     private:
+        template<typename T, typename... Args>
+        TypePtr Create(Args &&... args);
+
+        SymbolTable m_Symbols;
         std::map<std::string, TypePtr> m_Named;
 
+        TypeId m_NextId = 0;
+
         TypePtr m_Void, m_Number, m_String, m_AnyArray, m_AnyObject, m_AnyFunction;
-        std::map<TypePtr, TypePtr> m_Array;
-        std::map<std::map<std::string, TypePtr>, TypePtr> m_Struct;
-        std::map<std::vector<TypePtr>, TypePtr> m_Tuple;
-        std::map<std::set<TypePtr>, TypePtr> m_Union;
-        std::map<std::vector<TypePtr>, std::map<TypePtr, std::map<bool, TypePtr>>> m_Function;
+        std::unordered_map<TypeId, TypePtr> m_Array;
+        std::unordered_map<std::vector<std::pair<std::string, TypeId>>, TypePtr, TypeKeyHash> m_Struct;
+        std::unordered_map<std::vector<TypeId>, TypePtr, TypeKeyHash> m_Tuple;
+        std::unordered_map<std::vector<TypeId>, TypePtr, TypeKeyHash> m_Union;
+        std::unordered_map<std::vector<TypeId>, TypePtr, TypeKeyHash> m_Function;
+
+        /** type id in the upper, other type id in the lower half */
+        std::unordered_map<std::uint64_t, bool> m_Specializations;
     };
 
     struct Type
@@ -76,6 +104,7 @@ namespace mcc
 
         Context &Types;
         std::weak_ptr<Type> Self;
+        TypeId Id = 0;
     };
 
     struct VoidType final : Type
@@ -1,14 +1,60 @@
 #pragma once
 
 #include <mcc/common.hpp>
+#include <mcc/error.hpp>
 #include <mcc/package.hpp>
 #include <mcc/result.hpp>
 
 namespace mcc
 {
-    auto operator<=>(
-            const WeakValuePtr &lhs,
-            const WeakValuePtr &rhs);
+    /** ids are counted per unit; values keep a pointer to their space, since its offset is only set once every unit is lowered */
+    struct StackIdSpace
+    {
+        uint32_t Offset = 0;
+        uint32_t Count  = 0;
+    };
+
+    class StackIdScope
+    {
+    public:
+        explicit StackIdScope(StackIdSpace &space);
+        ~StackIdScope();
+
+        StackIdScope(const StackIdScope &)            = delete;
+        StackIdScope &operator=(const StackIdScope &) = delete;
+
+        static uint32_t Next();
+        static const StackIdSpace &Current();
+
+    private:
+        StackIdSpace *m_Previous;
+    };
+
+    class Use
+    {
+    public:
+        Use(const Use &)            = delete;
+        Use &operator=(const Use &) = delete;
+
+        [[nodiscard]] ValueBase *GetUser() const;
+        [[nodiscard]] Use *GetNext() const;
+
+        virtual void Set(const ValuePtr &value) = 0;
+
+    protected:
+        explicit Use(ValueBase *user);
+        Use(Use &&other) noexcept;
+        ~Use() = default;
+
+        void Link(ValueBase *value);
+        void Unlink();
+
+    private:
+        ValueBase *m_User;
+        ValueBase *m_Value = nullptr;
+        Use *m_Prev        = nullptr;
+        Use *m_Next        = nullptr;
+    };
 
     struct ValueBase
     {
@@ -16,7 +62,8 @@ namespace mcc
                 SourceLocation where,
                 std::string name,
                 TypePtr type,
-                FieldType_ field_type);
+                FieldType_ field_type,
+                bool has_stack_id = false);
         virtual ~ValueBase() = default;
 
         virtual void Generate(
@@ -27,23 +74,97 @@ namespace mcc
         [[nodiscard]] virtual Result GenerateResult() const;
         [[nodiscard]] virtual Result GenerateResultUnwrap() const;
 
-        virtual void Replace(
-                ValuePtr value,
-                ValuePtr replacement);
+        [[nodiscard]] bool HasUses() const;
+        [[nodiscard]] Use *GetFirstUse() const;
 
-        void Use(WeakValuePtr user);
-        void Drop(WeakValuePtr user);
+        void ReplaceAllUsesWith(const ValuePtr &replacement);
 
         [[nodiscard]] bool IsMutable() const;
+        [[nodiscard]] uint32_t GetStackId() const;
 
         SourceLocation Where;
         std::string Name;
         TypePtr Type;
         FieldType_ FieldType;
 
-        std::set<WeakValuePtr> Uses;
-
         const uint32_t StackId;
+
+    private:
+        friend class Use;
+
+        Use *m_FirstUse = nullptr;
+        const StackIdSpace *m_StackIds;
+    };
+
+    template<typename T>
+    class Operand final : public Use
+    {
+    public:
+        Operand(
+                ValueBase *user,
+                std::shared_ptr<T> value)
+            : Use(user),
+              m_Value(std::move(value))
+        {
+            Link(m_Value.get());
+        }
+
+        Operand(Operand &&other) noexcept
+            : Use(std::move(other)),
+              m_Value(std::move(other.m_Value))
+        {
+        }
+
+        ~Operand()
+        {
+            Unlink();
+        }
+
+        Operand &operator=(Operand &&) = delete;
+
+        void Set(const ValuePtr &value) override
+        {
+            auto cast = std::dynamic_pointer_cast<T>(value);
+            Assert(!!cast == !!value, "value cannot be used as this operand");
+
+            Unlink();
+            m_Value = std::move(cast);
+            Link(m_Value.get());
+        }
+
+        [[nodiscard]] const std::shared_ptr<T> &Get() const
+        {
+            return m_Value;
+        }
+
+        operator const std::shared_ptr<T> &() const // NOLINT(*-explicit-constructor)
+        {
+            return m_Value;
+        }
+
+        T *operator->() const
+        {
+            return m_Value.get();
+        }
+
+        explicit operator bool() const
+        {
+            return !!m_Value;
+        }
+
+        bool operator==(const Operand &other) const
+        {
+            return m_Value == other.m_Value;
+        }
+
+        template<typename U>
+        bool operator==(const std::shared_ptr<U> &other) const
+        {
+            return m_Value == other;
+        }
+
+    private:
+        std::shared_ptr<T> m_Value;
     };
 
     template<typename T>
@@ -108,13 +229,12 @@ namespace mcc
                 const TypePtr &type,
                 const ValuePtr &base,
                 const ValuePtr &index);
-        ~ElementReference() override;
 
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr Base;
-        ValuePtr Index;
+        Operand<ValueBase> Base;
+        Operand<ValueBase> Index;
     };
 
     struct FunctionResult final : Value<FunctionResult>
@@ -182,12 +302,11 @@ namespace mcc
                 ValuePtr position_y,
                 ValuePtr position_z,
                 ValuePtr path);
-        ~GenericBlockReference() override;
 
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr PositionX, PositionY, PositionZ, Path;
+        Operand<ValueBase> PositionX, PositionY, PositionZ, Path;
     };
 
     struct GenericEntityReference final : Value<GenericEntityReference>
@@ -205,12 +324,11 @@ namespace mcc
                 const TypePtr &type,
                 ValuePtr name_val,
                 ValuePtr path);
-        ~GenericEntityReference() override;
 
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr NameVal, Path;
+        Operand<ValueBase> NameVal, Path;
     };
 
     struct GenericStorageReference final : Value<GenericStorageReference>
@@ -238,12 +356,11 @@ namespace mcc
                 ValuePtr location,
                 ValuePtr path,
                 bool is_mutable);
-        ~GenericStorageReference() override;
 
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr Location, Path;
+        Operand<ValueBase> Location, Path;
     };
 
     struct MemberReference final : Value<MemberReference>
@@ -260,12 +377,11 @@ namespace mcc
                 const TypePtr &type,
                 const ValuePtr &object,
                 std::string member);
-        ~MemberReference() override;
 
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr Object;
+        Operand<ValueBase> Object;
         std::string Member;
     };
 
@@ -280,11 +396,10 @@ namespace mcc
                 const SourceLocation &where,
                 const std::string &name,
                 const ValuePtr &target);
-        ~StringifyValue() override;
 
         [[nodiscard]] bool RequireStack() const override;
         [[nodiscard]] Result GenerateResult() const override;
 
-        ValuePtr Target;
+        Operand<ValueBase> Target;
     };
 }
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <mcc/common.hpp>
+
+#include <map>
+#include <set>
+
+namespace mcc
+{
+    class Watcher
+    {
+    public:
+        explicit Watcher(std::filesystem::path root);
+        ~Watcher();
+
+        Watcher(const Watcher &)            = delete;
+        Watcher &operator=(const Watcher &) = delete;
+
+        std::set<std::filesystem::path> Wait();
+
+    private:
+        void Add(const std::filesystem::path &directory);
+
+        std::filesystem::path m_Root;
+#ifdef __linux__
+        int m_Descriptor = -1;
+        std::map<int, std::filesystem::path> m_Directories;
+#else
+        std::map<std::filesystem::path, std::filesystem::file_time_type> m_Times;
+#endif
+    };
+}
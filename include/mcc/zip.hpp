@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace mcc
+{
+    enum class ZipMethod_ : std::uint16_t
+    {
+        Store   = 0,
+        Deflate = 8,
+    };
+
+    struct ZipEntry
+    {
+        static ZipEntry Compress(
+                std::string name,
+                const std::string &content,
+                ZipMethod_ method);
+
+        std::string Name;
+        ZipMethod_ Method;
+        std::uint32_t Crc;
+        std::uint32_t Size;
+        std::string Data;
+    };
+
+    class ZipWriter
+    {
+    public:
+        explicit ZipWriter(const std::filesystem::path &path);
+
+        void Add(const ZipEntry &entry);
+        void Finish();
+
+    private:
+        struct Record
+        {
+            std::string Name;
+            ZipMethod_ Method;
+            std::uint32_t Crc;
+            std::uint32_t CompressedSize;
+            std::uint32_t Size;
+            std::uint64_t Offset;
+        };
+
+        std::filesystem::path m_Path;
+        std::ofstream m_Stream;
+        std::vector<Record> m_Records;
+        std::uint64_t m_Offset = 0;
+    };
+}
@@ -0,0 +1,60 @@
+#include <mcc/arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+static constexpr size_t min_block_size = 4 * 1024;
+static constexpr size_t max_block_size = 64 * 1024;
+
+static std::byte *align(
+        std::byte *pointer,
+        const size_t alignment)
+{
+    const auto address = reinterpret_cast<uintptr_t>(pointer);
+    return pointer + ((alignment - address % alignment) % alignment);
+}
+
+static thread_local std::shared_ptr<mcc::Arena> current_arena = std::make_shared<mcc::Arena>();
+
+const std::shared_ptr<mcc::Arena> &mcc::Arena::Current()
+{
+    return current_arena;
+}
+
+void *mcc::Arena::Allocate(
+        const size_t size,
+        const size_t alignment)
+{
+    if (const auto head = align(m_Head, alignment); m_Head && head + size <= m_End)
+    {
+        m_Head = head + size;
+        return head;
+    }
+
+    if (size + alignment > max_block_size / 4)
+    {
+        auto &block = m_Blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size + alignment));
+        return align(block.get(), alignment);
+    }
+
+    const auto capacity = std::max(
+            std::min(min_block_size << std::min<size_t>(m_Blocks.size(), 4), max_block_size),
+            size + alignment);
+
+    auto &block     = m_Blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(capacity));
+    const auto head = align(block.get(), alignment);
+    m_Head          = head + size;
+    m_End           = block.get() + capacity;
+    return head;
+}
+
+mcc::ArenaScope::ArenaScope(std::shared_ptr<Arena> arena)
+    : m_Previous(std::move(arena))
+{
+    std::swap(current_arena, m_Previous);
+}
+
+mcc::ArenaScope::~ArenaScope()
+{
+    std::swap(current_arena, m_Previous);
+}
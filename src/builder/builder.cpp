@@ -7,9 +7,11 @@
 
 mcc::Builder::Builder(
         Context &context,
-        Package &package)
+        Package &package,
+        IncludeCache &includes)
     : m_Context(context),
       m_Package(package),
+      m_Includes(includes),
       m_Module(m_Context)
 {
 }
@@ -24,6 +26,21 @@ mcc::Package &mcc::Builder::GetPackage() const
     return m_Package;
 }
 
+mcc::IncludeCache &mcc::Builder::GetIncludes() const
+{
+    return m_Includes;
+}
+
+void mcc::Builder::AddDependency(const std::filesystem::path &path)
+{
+    m_Dependencies.insert(path);
+}
+
+const std::set<std::filesystem::path> &mcc::Builder::GetDependencies() const
+{
+    return m_Dependencies;
+}
+
 std::string mcc::Builder::GetNamespace() const
 {
     return m_Namespace;
@@ -62,6 +79,7 @@ mcc::InstructionPtr mcc::Builder::Insert(
     Assert(!!instruction, where, "instruction must not be null");
 
     m_InsertBlock->Instructions.push_back(instruction);
+    m_InsertBlock->Parent->Invalidate();
     return instruction;
 }
 
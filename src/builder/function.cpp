@@ -29,35 +29,41 @@ mcc::FunctionPtr mcc::Builder::GetFunction(
     return m_Module.GetFunction(location, parameters);
 }
 
-std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(
-        const ResourceLocation &location,
-        const ParameterRefList &parameters) const
+static bool accepts(
+        const mcc::FunctionPtr &function,
+        const mcc::ParameterRefList &parameters)
 {
-    std::vector<FunctionPtr> collection;
-    for (auto &function : m_Module)
-    {
-        if (function->Location != location)
-            continue;
-
-        if (parameters.size() != function->Parameters.size())
-            continue;
-
-        unsigned i;
-        for (i = 0; i < parameters.size(); ++i)
-        {
-            if (!SameOrSpecialization(parameters[i].Type, function->Parameters[i].Type))
-                break;
-            if (parameters[i].FieldType < function->Parameters[i].FieldType)
-                break;
-        }
-        if (i < parameters.size())
-            continue;
+    if (parameters.size() != function->Parameters.size())
+        return false;
 
-        collection.push_back(function);
+    for (unsigned i = 0; i < parameters.size(); ++i)
+    {
+        if (!mcc::SameOrSpecialization(parameters[i].Type, function->Parameters[i].Type))
+            return false;
+        if (parameters[i].FieldType < function->Parameters[i].FieldType)
+            return false;
     }
+    return true;
+}
+
+static std::vector<mcc::FunctionPtr> filter(
+        const std::vector<mcc::FunctionPtr> &overloads,
+        const mcc::ParameterRefList &parameters)
+{
+    std::vector<mcc::FunctionPtr> collection;
+    for (auto &function : overloads)
+        if (accepts(function, parameters))
+            collection.push_back(function);
     return collection;
 }
 
+std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(
+        const ResourceLocation &location,
+        const ParameterRefList &parameters) const
+{
+    return filter(m_Module.GetOverloads(location), parameters);
+}
+
 std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(
         const std::vector<std::string> &path,
         const ParameterRefList &parameters,
@@ -66,42 +72,12 @@ std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(
     if (use_namespace)
         return FindFunctions({ m_Namespace, { path } }, parameters);
 
-    std::vector<FunctionPtr> collection;
-    for (auto &function : m_Module)
-    {
-        if (function->Location.Path != path)
-            continue;
-
-        if (parameters.size() != function->Parameters.size())
-            continue;
-
-        unsigned i;
-        for (i = 0; i < parameters.size(); ++i)
-        {
-            if (!SameOrSpecialization(parameters[i].Type, function->Parameters[i].Type))
-                break;
-            if (parameters[i].FieldType < function->Parameters[i].FieldType)
-                break;
-        }
-        if (i < parameters.size())
-            continue;
-
-        collection.push_back(function);
-    }
-    return collection;
+    return filter(m_Module.GetOverloads(path), parameters);
 }
 
 std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(const ResourceLocation &location) const
 {
-    std::vector<FunctionPtr> collection;
-    for (auto &function : m_Module)
-    {
-        if (function->Location != location)
-            continue;
-
-        collection.push_back(function);
-    }
-    return collection;
+    return m_Module.GetOverloads(location);
 }
 
 std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(
@@ -111,15 +87,7 @@ std::vector<mcc::FunctionPtr> mcc::Builder::FindFunctions(
     if (use_namespace)
         return FindFunctions({ m_Namespace, { path } });
 
-    std::vector<FunctionPtr> collection;
-    for (auto &function : m_Module)
-    {
-        if (function->Location.Path != path)
-            continue;
-
-        collection.push_back(function);
-    }
-    return collection;
+    return m_Module.GetOverloads(path);
 }
 
 mcc::FunctionPtr mcc::Builder::FindUnambiguousCandidate(
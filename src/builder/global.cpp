@@ -10,7 +10,7 @@ mcc::ValuePtr mcc::Builder::CreateGlobal(
     if (location.Namespace.empty())
         location.Namespace = m_Namespace;
 
-    auto &global = m_Globals[location.Namespace][location.Path];
+    auto &global = m_Globals[ResourceTable::Intern(location)];
     Assert(!global, where, "global {} is already defined", location);
     return global = GenericStorageReference::Create(
                    where,
@@ -26,7 +26,7 @@ bool mcc::Builder::HasGlobal(ResourceLocation location) const
     if (location.Namespace.empty())
         location.Namespace = m_Namespace;
 
-    return m_Globals.contains(location.Namespace) && m_Globals.at(location.Namespace).contains(location.Path);
+    return m_Globals.contains(ResourceTable::Intern(location));
 }
 
 mcc::ValuePtr mcc::Builder::GetGlobal(
@@ -36,8 +36,8 @@ mcc::ValuePtr mcc::Builder::GetGlobal(
     if (location.Namespace.empty())
         location.Namespace = m_Namespace;
 
-    Assert(m_Globals.contains(location.Namespace), where, "undefined namespace {}", location.Namespace);
-    Assert(m_Globals.at(location.Namespace).contains(location.Path), where, "undefined global {}", location);
+    const auto it = m_Globals.find(ResourceTable::Intern(location));
+    Assert(it != m_Globals.end(), where, "undefined global {}", location);
 
-    return m_Globals.at(location.Namespace).at(location.Path);
+    return it->second;
 }
@@ -0,0 +1,196 @@
+#include <mcc/build_id.hpp>
+#include <mcc/cache.hpp>
+#include <mcc/error.hpp>
+
+#include <fstream>
+
+static constexpr std::string_view cache_magic = "mcc-cache 2 " MCC_BUILD_ID;
+
+static void write_string(
+        std::ostream &stream,
+        const std::string_view value)
+{
+    stream << value.size() << ' ' << value << '\n';
+}
+
+static bool read_string(
+        std::istream &stream,
+        std::string &value)
+{
+    size_t size;
+    if (!(stream >> size) || stream.get() != ' ')
+        return false;
+
+    value.resize(size);
+    return static_cast<bool>(stream.read(value.data(), static_cast<std::streamsize>(size)));
+}
+
+static void write_path(
+        std::ostream &stream,
+        const std::vector<std::string> &path)
+{
+    stream << path.size() << '\n';
+    for (auto &segment : path)
+        write_string(stream, segment);
+}
+
+static bool read_path(
+        std::istream &stream,
+        std::vector<std::string> &path)
+{
+    size_t size;
+    if (!(stream >> size))
+        return false;
+
+    path.resize(size);
+    for (auto &segment : path)
+        if (!read_string(stream, segment))
+            return false;
+    return true;
+}
+
+mcc::HashT mcc::Hash(const std::string_view data)
+{
+    HashT hash = 14695981039346656037ull;
+    for (const auto c : data)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+mcc::BuildCache::BuildCache(std::filesystem::path directory)
+    : m_Directory(std::move(directory))
+{
+}
+
+bool mcc::BuildCache::Load(
+        const std::filesystem::path &source,
+        CacheEntry &entry,
+        Package &package) const
+{
+    if (m_Directory.empty())
+        return false;
+
+    std::ifstream stream(GetEntryPath(source), std::ios::binary);
+    if (!stream.is_open())
+        return false;
+
+    std::string magic;
+    if (!std::getline(stream, magic) || magic != cache_magic)
+        return false;
+
+    size_t include_count;
+    if (!(stream >> entry.Source >> entry.StackIds.Offset >> entry.StackIds.Count >> include_count))
+        return false;
+
+    for (size_t i = 0; i < include_count; ++i)
+    {
+        HashT hash;
+        std::string path;
+        if (!(stream >> hash) || !read_string(stream, path))
+            return false;
+        entry.Includes[path] = hash;
+    }
+
+    size_t function_count;
+    if (!(stream >> function_count))
+        return false;
+
+    for (size_t i = 0; i < function_count; ++i)
+    {
+        std::string namespace_;
+        std::vector<std::string> path;
+        if (!read_string(stream, namespace_) || !read_path(stream, path))
+            return false;
+
+        if (auto &function = package.Functions[ResourceTable::Intern({ namespace_, path })];
+            !read_string(stream, function.Data()))
+            return false;
+    }
+
+    size_t tag_count;
+    if (!(stream >> tag_count))
+        return false;
+
+    for (size_t i = 0; i < tag_count; ++i)
+    {
+        std::string namespace_;
+        std::vector<std::string> path;
+        bool replace;
+        size_t value_count;
+        if (!read_string(stream, namespace_) || !read_path(stream, path) || !(stream >> replace >> value_count))
+            return false;
+
+        auto &[replace_, values_] = package.Tags[ResourceTable::Intern({ namespace_, path })];
+        replace_                  = replace;
+        values_.resize(value_count);
+        for (auto &[location_, required_] : values_)
+        {
+            ResourceLocation location;
+            if (!read_string(stream, location.Namespace) || !read_path(stream, location.Path) || !(stream >> required_))
+                return false;
+            location_ = ResourceTable::Intern(location);
+        }
+    }
+
+    return true;
+}
+
+void mcc::BuildCache::Store(
+        const std::filesystem::path &source,
+        const CacheEntry &entry,
+        const Package &package) const
+{
+    if (m_Directory.empty())
+        return;
+
+    const auto path = GetEntryPath(source);
+    create_directories(path.parent_path());
+
+    std::ofstream stream(path, std::ios::binary);
+    Assert(stream.is_open(), "failed to open file {}", path.string());
+
+    stream << cache_magic << '\n';
+    stream << entry.Source << ' ' << entry.StackIds.Offset << ' ' << entry.StackIds.Count << '\n';
+
+    stream << entry.Includes.size() << '\n';
+    for (auto &[include_, hash_] : entry.Includes)
+    {
+        stream << hash_ << ' ';
+        write_string(stream, include_.string());
+    }
+
+    stream << package.Functions.size() << '\n';
+    for (auto &[id_, commands_] : package.Functions)
+    {
+        auto &[namespace_, path_] = ResourceTable::Get(id_);
+        write_string(stream, namespace_);
+        write_path(stream, path_);
+        write_string(stream, commands_.Data());
+    }
+
+    stream << package.Tags.size() << '\n';
+    for (auto &[id_, tag_] : package.Tags)
+    {
+        auto &[namespace_, path_] = ResourceTable::Get(id_);
+        write_string(stream, namespace_);
+        write_path(stream, path_);
+        stream << tag_.Replace << ' ' << tag_.Values.size() << '\n';
+        for (auto &[location_, required_] : tag_.Values)
+        {
+            auto &[value_namespace_, value_path_] = ResourceTable::Get(location_);
+            write_string(stream, value_namespace_);
+            write_path(stream, value_path_);
+            stream << required_ << '\n';
+        }
+    }
+}
+
+std::filesystem::path mcc::BuildCache::GetEntryPath(const std::filesystem::path &source) const
+{
+    auto path = m_Directory / source.relative_path();
+    path += ".cache";
+    return path;
+}
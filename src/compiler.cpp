@@ -0,0 +1,368 @@
+#include <mcc/compiler.hpp>
+#include <mcc/error.hpp>
+#include <mcc/parse.hpp>
+#include <mcc/source.hpp>
+#include <mcc/statement.hpp>
+#include <mcc/trace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+mcc::Compiler::Unit::Unit(
+        const PackageInfo &info,
+        std::filesystem::path path)
+    : Path(std::move(path)),
+      Output(info)
+{
+}
+
+mcc::Compiler::Compiler(
+        const PackageInfo &info,
+        const unsigned jobs,
+        std::filesystem::path cache_directory)
+    : m_Info(info),
+      m_Cache(std::move(cache_directory)),
+      m_Workers(std::max(jobs, 1u))
+{
+}
+
+static void generate_node(
+        const mcc::TreeNode &node,
+        mcc::Builder &builder)
+{
+    mcc::TraceSpan span("TreeNode::Generate");
+    span.Arg("row", node.Where.Row);
+
+    node.Generate(builder);
+}
+
+size_t mcc::Compiler::Compile(
+        Package &package,
+        const std::vector<std::filesystem::path> &paths)
+{
+    std::erase_if(
+            m_Units,
+            [&paths](auto &entry) { return std::ranges::find(paths, entry.first) == paths.end(); });
+
+    m_Order.clear();
+    for (auto &worker : m_Workers)
+        worker.Units.clear();
+
+    std::vector<Unit *> pending;
+    {
+        TraceSpan span("Compiler::Check");
+        for (auto &path : paths)
+        {
+            auto &unit = m_Units.try_emplace(path, m_Info, path).first->second;
+            m_Order.push_back(&unit);
+
+            Check(unit);
+            if (!unit.Cached)
+                pending.push_back(&unit);
+        }
+        span.Arg("files", paths.size()).Arg("pending", pending.size());
+    }
+
+    std::atomic_size_t next = 0;
+    std::atomic_bool failed = false;
+
+    RunWorkers(
+            [&](Worker &worker)
+            {
+                for (size_t i; !failed && (i = next++) < pending.size();)
+                {
+                    auto &unit = *pending[i];
+                    worker.Units.push_back(&unit);
+
+                    try
+                    {
+                        Lower(worker, unit);
+                    }
+                    catch (...)
+                    {
+                        unit.Exception = std::current_exception();
+                        failed         = true;
+                    }
+                }
+            });
+
+    if (!failed)
+    {
+        AllocateStackIds();
+
+        RunWorkers(
+                [&](Worker &worker)
+                {
+                    for (const auto unit : worker.Units)
+                    {
+                        if (failed)
+                            break;
+
+                        try
+                        {
+                            Generate(*unit);
+                        }
+                        catch (...)
+                        {
+                            unit->Exception = std::current_exception();
+                            failed          = true;
+                        }
+                    }
+                });
+    }
+
+    if (failed)
+    {
+        // partial output must not be reused by the next run
+        std::exception_ptr exception;
+        for (const auto unit : m_Order)
+        {
+            if (!exception)
+                exception = unit->Exception;
+
+            if (unit->Cached)
+                continue;
+
+            unit->Builder.reset();
+            unit->Arena.reset();
+            unit->Exception = {};
+            unit->Known     = false;
+        }
+        std::rethrow_exception(exception);
+    }
+
+    {
+        TraceSpan span("BuildCache::Store");
+        for (const auto unit : pending)
+        {
+            for (auto &[include_, hash_] : unit->Entry.Includes)
+                hash_ = HashFile(include_);
+
+            unit->Entry.StackIds = unit->StackIds;
+            unit->Known          = true;
+            m_Cache.Store(unit->Path, unit->Entry, unit->Output);
+        }
+    }
+
+    {
+        TraceSpan span("Package::Merge");
+        for (const auto unit : m_Order)
+            package.Merge(unit->Output);
+    }
+
+    package.AddLoadFunction();
+
+    return pending.size();
+}
+
+void mcc::Compiler::CompileWhole(
+        Package &package,
+        const std::vector<std::filesystem::path> &paths)
+{
+    auto &[context_, includes_, units_] = m_Workers.front();
+
+    StackIdSpace stack_ids;
+    const StackIdScope scope(stack_ids);
+
+    const auto arena = std::make_shared<Arena>();
+    const ArenaScope arena_scope(arena);
+
+    Builder builder(context_, package, includes_);
+
+    std::vector<std::vector<TreeNodePtr>> files;
+    for (auto &path : paths)
+    {
+        const SourceBuffer source(path);
+        Assert(source.IsOpen(), "failed to open file {}", path.string());
+
+        context_.ClearNamed();
+        builder.SetNamespace({});
+
+        std::set<std::filesystem::path> include_chain;
+        include_chain.insert(weakly_canonical(path));
+
+        auto &nodes = files.emplace_back();
+
+        TraceSpan span("Parser::Parse");
+        span.Arg("file", path.string());
+
+        Parser parser(context_, source.View(), path.string());
+        while (parser)
+            if (auto node = parser())
+            {
+                node->GenerateInclude(builder, include_chain);
+                nodes.emplace_back(std::move(node));
+            }
+
+        span.Arg("tokens", parser.Tokens()).Arg("nodes", nodes.size());
+    }
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        TraceSpan span("Compiler::Lower");
+        span.Arg("file", paths[i].string()).Arg("nodes", files[i].size());
+
+        builder.SetNamespace({});
+        for (auto &node : files[i])
+            generate_node(*node, builder);
+    }
+
+    {
+        TraceSpan span("Builder::Generate");
+        builder.Generate();
+    }
+
+    package.AddLoadFunction();
+}
+
+void mcc::Compiler::Invalidate(const std::filesystem::path &path)
+{
+    const auto canonical_path = weakly_canonical(path);
+
+    m_Hashes.erase(path);
+    m_Hashes.erase(canonical_path);
+
+    for (auto &worker : m_Workers)
+        worker.Includes.Erase(canonical_path);
+}
+
+mcc::HashT mcc::Compiler::HashFile(const std::filesystem::path &path)
+{
+    if (const auto it = m_Hashes.find(path); it != m_Hashes.end())
+        return it->second;
+
+    const SourceBuffer source(path);
+    return m_Hashes[path] = source.IsOpen() ? Hash(source.View()) : 0;
+}
+
+void mcc::Compiler::Check(Unit &unit)
+{
+    const auto source = HashFile(unit.Path);
+
+    if (!unit.Known)
+    {
+        unit.Output.Functions.clear();
+        unit.Output.Tags.clear();
+        unit.Entry = {};
+        unit.Known = m_Cache.Load(unit.Path, unit.Entry, unit.Output);
+    }
+
+    unit.Cached = unit.Known
+                  && unit.Entry.Source == source
+                  && std::ranges::all_of(
+                          unit.Entry.Includes,
+                          [this](auto &include) { return HashFile(include.first) == include.second; });
+
+    if (unit.Cached)
+    {
+        unit.StackIds = unit.Entry.StackIds;
+        return;
+    }
+
+    unit.Output.Functions.clear();
+    unit.Output.Tags.clear();
+    unit.StackIds     = {};
+    unit.Entry.Source = source;
+}
+
+void mcc::Compiler::Lower(
+        Worker &worker,
+        Unit &unit) const
+{
+    const StackIdScope scope(unit.StackIds);
+
+    unit.Arena = std::make_shared<Arena>();
+    const ArenaScope arena_scope(unit.Arena);
+
+    const SourceBuffer source(unit.Path);
+    Assert(source.IsOpen(), "failed to open file {}", unit.Path.string());
+
+    worker.Context.ClearNamed();
+
+    TraceSpan span("Compiler::Lower");
+    span.Arg("file", unit.Path.string());
+
+    Parser parser(worker.Context, source.View(), unit.Path.string());
+    unit.Builder = std::make_unique<mcc::Builder>(worker.Context, unit.Output, worker.Includes);
+
+    size_t node_count = 0;
+    while (parser)
+        if (const auto node = parser())
+        {
+            generate_node(*node, *unit.Builder);
+            ++node_count;
+        }
+
+    span.Arg("tokens", parser.Tokens()).Arg("nodes", node_count);
+}
+
+void mcc::Compiler::Generate(Unit &unit)
+{
+    const StackIdScope scope(unit.StackIds);
+    const ArenaScope arena_scope(unit.Arena);
+
+    TraceSpan span("Compiler::Generate");
+    span.Arg("file", unit.Path.string());
+
+    unit.Builder->Generate();
+
+    unit.Entry.Includes.clear();
+    for (auto &dependency : unit.Builder->GetDependencies())
+        unit.Entry.Includes[dependency] = 0;
+
+    unit.Builder.reset();
+    unit.Arena.reset();
+}
+
+// a recompiled unit keeps its previous id range unless that collides with a cached one
+void mcc::Compiler::AllocateStackIds()
+{
+    std::vector<std::pair<uint32_t, uint32_t>> used;
+    uint32_t end = 0;
+
+    auto reserve = [&used, &end](const uint32_t begin_, const uint32_t end_)
+    {
+        used.emplace_back(begin_, end_);
+        end = std::max(end, end_);
+    };
+
+    auto overlaps = [&used](const uint32_t begin_, const uint32_t end_)
+    {
+        return std::ranges::any_of(used, [&](auto &range) { return begin_ < range.second && range.first < end_; });
+    };
+
+    for (const auto unit : m_Order)
+        if (unit->Cached)
+            reserve(unit->StackIds.Offset, unit->StackIds.Offset + unit->StackIds.Count);
+
+    for (const auto unit : m_Order)
+    {
+        if (unit->Cached)
+            continue;
+
+        auto &[offset_, count_] = unit->StackIds;
+        if (const auto previous = unit->Entry.StackIds.Offset; unit->Known && !overlaps(previous, previous + count_))
+            offset_ = previous;
+        else
+            offset_ = end;
+
+        reserve(offset_, offset_ + count_);
+    }
+}
+
+template<typename F>
+void mcc::Compiler::RunWorkers(F &&task)
+{
+    if (m_Workers.size() == 1)
+    {
+        task(m_Workers.front());
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    for (auto &worker : m_Workers)
+        threads.emplace_back([&task, &worker] { task(worker); });
+    for (auto &thread : threads)
+        thread.join();
+}
@@ -1,6 +1,5 @@
 #include <mcc/error.hpp>
 
-#include <filesystem>
 #include <iostream>
 
 void mcc::Error(const char *message) noexcept(false)
@@ -19,8 +18,7 @@ void mcc::Error(
         const SourceLocation &where,
         const char *message) noexcept(false)
 {
-    std::cerr << std::filesystem::canonical(where.Filename).string() << ':' << where.Row << ':' << where.Col << ": "
-              << message << std::endl;
+    std::cerr << std::format("{}: {}", where, message) << std::endl;
     throw std::runtime_error(message);
 }
 
@@ -28,8 +26,7 @@ void mcc::Error(
         const SourceLocation &where,
         const std::string &message) noexcept(false)
 {
-    std::cerr << std::filesystem::canonical(where.Filename).string() << ':' << where.Row << ':' << where.Col << ": "
-              << message << std::endl;
+    std::cerr << std::format("{}: {}", where, message) << std::endl;
     throw std::runtime_error(message);
 }
 
@@ -37,8 +34,7 @@ void mcc::Warning(
         const SourceLocation &where,
         const char *message)
 {
-    std::cerr << std::filesystem::canonical(where.Filename).string() << ':' << where.Row << ':' << where.Col << ": "
-              << message << std::endl;
+    std::cerr << std::format("{}: {}", where, message) << std::endl;
 }
 
 void mcc::Assert(
@@ -6,7 +6,7 @@ mcc::ValuePtr mcc::ArgumentValue::Create(
         const std::string &name,
         const TypePtr &type)
 {
-    auto self  = std::make_shared<ArgumentValue>(where, name, type);
+    auto self  = MakeValue<ArgumentValue>(where, name, type);
     self->Self = self;
     return self;
 }
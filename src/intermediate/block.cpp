@@ -13,9 +13,10 @@ mcc::BlockPtr mcc::Block::Create(
         Context &context,
         const FunctionPtr &parent)
 {
-    auto self  = std::make_shared<Block>(where, name, context, parent);
+    auto self  = MakeValue<Block>(where, name, context, parent);
     self->Self = self;
     parent->Blocks.push_back(self);
+    parent->Invalidate();
     return self;
 }
 
@@ -7,7 +7,7 @@ mcc::ValuePtr mcc::BranchResult::Create(
         const TypePtr &type,
         const FunctionPtr &parent)
 {
-    auto self  = std::make_shared<BranchResult>(where, name, type, parent);
+    auto self  = MakeValue<BranchResult>(where, name, type, parent);
     self->Self = self;
     return self;
 }
@@ -20,7 +20,8 @@ mcc::BranchResult::BranchResult(
     : Value(where,
             name,
             type,
-            FieldType_::ImmutableReference),
+            FieldType_::ImmutableReference,
+            true),
       Parent(std::move(parent))
 {
 }
@@ -35,7 +36,7 @@ mcc::Result mcc::BranchResult::GenerateResult() const
     return {
         .Type          = ResultType_::Reference,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
-        .Path          = std::format("stack[0].x{}", StackId),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
+        .Path          = std::format("stack[0].x{}", GetStackId()),
     };
 }
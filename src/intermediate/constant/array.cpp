@@ -7,12 +7,8 @@ mcc::ConstantPtr mcc::ConstantArray::Create(
         const std::vector<ConstantPtr> &values,
         const bool stringify)
 {
-    auto self = std::make_shared<ConstantArray>(where, type, values, stringify);
-
+    auto self  = MakeValue<ConstantArray>(where, type, values, stringify);
     self->Self = self;
-    for (const auto &value : self->Values)
-        value->Use(self);
-
     return self;
 }
 
@@ -39,15 +35,11 @@ mcc::ConstantArray::ConstantArray(
     : Constant(
               where,
               type),
-      Values(values),
       Stringify(stringify)
 {
-}
-
-mcc::ConstantArray::~ConstantArray()
-{
-    for (const auto &value : Values)
-        value->Drop(Self);
+    Values.reserve(values.size());
+    for (auto &value : values)
+        Values.emplace_back(this, value);
 }
 
 mcc::Result mcc::ConstantArray::GenerateResult() const
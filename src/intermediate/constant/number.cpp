@@ -6,7 +6,7 @@ mcc::ConstantPtr mcc::ConstantNumber::Create(
         Context &context,
         const IntegerT value)
 {
-    auto self  = std::make_shared<ConstantNumber>(where, context, value);
+    auto self  = MakeValue<ConstantNumber>(where, context, value);
     self->Self = self;
     return self;
 }
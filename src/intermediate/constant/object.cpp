@@ -1,8 +1,6 @@
 #include <mcc/constant.hpp>
 #include <mcc/type.hpp>
 
-#include <ranges>
-
 mcc::ConstantPtr mcc::ConstantObject::Create(
         const SourceLocation &where,
         const TypePtr &type,
@@ -11,12 +9,8 @@ mcc::ConstantPtr mcc::ConstantObject::Create(
                 ConstantPtr
         > &values)
 {
-    auto self = std::make_shared<ConstantObject>(where, type, values);
-
+    auto self  = MakeValue<ConstantObject>(where, type, values);
     self->Self = self;
-    for (const auto &value : self->Values | std::views::values)
-        value->Use(self);
-
     return self;
 }
 
@@ -44,15 +38,10 @@ mcc::ConstantObject::ConstantObject(
         > &values)
     : Constant(
               where,
-              type),
-      Values(values)
-{
-}
-
-mcc::ConstantObject::~ConstantObject()
+              type)
 {
-    for (const auto &value : Values | std::views::values)
-        value->Drop(Self);
+    for (auto &[key_, value_] : values)
+        Values.try_emplace(key_, this, value_);
 }
 
 mcc::Result mcc::ConstantObject::GenerateResult() const
@@ -6,7 +6,7 @@ mcc::ConstantPtr mcc::ConstantResource::Create(
         const TypePtr &type,
         const ResourceLocation &location)
 {
-    auto self  = std::make_shared<ConstantResource>(where, type, location);
+    auto self  = MakeValue<ConstantResource>(where, type, location);
     self->Self = self;
     return self;
 }
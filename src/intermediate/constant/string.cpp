@@ -6,7 +6,7 @@ mcc::ConstantPtr mcc::ConstantString::Create(
         Context &context,
         const std::string &value)
 {
-    auto self  = std::make_shared<ConstantString>(where, context, value);
+    auto self  = MakeValue<ConstantString>(where, context, value);
     self->Self = self;
     return self;
 }
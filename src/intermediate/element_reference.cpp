@@ -28,12 +28,8 @@ mcc::ElementReference::SPtr mcc::ElementReference::Create(
     else
         Error(where, "base must be of type array or tuple");
 
-    auto self = std::make_shared<ElementReference>(where, name, type, base, index);
-
+    auto self  = MakeValue<ElementReference>(where, name, type, base, index);
     self->Self = self;
-    self->Base->Use(self);
-    self->Index->Use(self);
-
     return self;
 }
 
@@ -47,15 +43,9 @@ mcc::ElementReference::ElementReference(
             name,
             type,
             base->FieldType),
-      Base(base),
-      Index(index)
-{
-}
-
-mcc::ElementReference::~ElementReference()
+      Base(this, base),
+      Index(this, index)
 {
-    Base->Drop(Self);
-    Index->Drop(Self);
 }
 
 bool mcc::ElementReference::RequireStack() const
@@ -2,12 +2,70 @@
 #include <mcc/command.hpp>
 #include <mcc/error.hpp>
 #include <mcc/function.hpp>
+#include <mcc/instruction.hpp>
 #include <mcc/module.hpp>
+#include <mcc/trace.hpp>
 #include <mcc/type.hpp>
 #include <mcc/value.hpp>
 
 #include <algorithm>
 
+static size_t count_instructions(const std::vector<mcc::BlockPtr> &blocks)
+{
+    size_t count = 0;
+    for (auto &block : blocks)
+        count += block->Instructions.size();
+    return count;
+}
+
+static bool reads_score(
+        const mcc::ValueBase &user,
+        const mcc::Use *use)
+{
+    if (dynamic_cast<const mcc::OperationInstruction *>(&user) || dynamic_cast<const mcc::ComparisonInstruction *>(&user))
+        return true;
+
+    if (const auto store = dynamic_cast<const mcc::StoreInstruction *>(&user))
+        return use == &store->Src;
+
+    if (const auto branch = dynamic_cast<const mcc::BranchInstruction *>(&user))
+        return use == &branch->Condition;
+
+    if (const auto switch_ = dynamic_cast<const mcc::SwitchInstruction *>(&user))
+        return use == &switch_->Condition;
+
+    return false;
+}
+
+static bool clobbers_registers(const mcc::Instruction &instruction)
+{
+    return dynamic_cast<const mcc::CallInstruction *>(&instruction)
+           || dynamic_cast<const mcc::CommandInstruction *>(&instruction);
+}
+
+static std::optional<size_t> live_range_end(
+        const std::vector<mcc::InstructionPtr> &instructions,
+        const std::unordered_map<const mcc::ValueBase *, size_t> &positions,
+        const size_t index)
+{
+    auto end = index;
+    for (auto use = instructions[index]->GetFirstUse(); use; use = use->GetNext())
+    {
+        const auto user = use->GetUser();
+        const auto it   = positions.find(user);
+        if (it == positions.end() || it->second <= index || !reads_score(*user, use))
+            return std::nullopt;
+
+        end = std::max(end, it->second);
+    }
+
+    for (auto i = index + 1; i < end; ++i)
+        if (clobbers_registers(*instructions[i]))
+            return std::nullopt;
+
+    return end;
+}
+
 mcc::FunctionPtr mcc::Function::Create(
         const SourceLocation &where,
         Module &module,
@@ -21,7 +79,7 @@ mcc::FunctionPtr mcc::Function::Create(
         parameter_types.push_back(type_);
 
     auto type  = module.GetContext().GetFunction(parameter_types, result_type, throws);
-    auto self  = std::make_shared<Function>(where, type, module, location, parameters, result_type, throws);
+    auto self  = MakeValue<Function>(where, type, module, location, parameters, result_type, throws);
     self->Self = self;
     return self;
 }
@@ -55,6 +113,9 @@ void mcc::Function::Generate(
 
 bool mcc::Function::RequireStack() const
 {
+    if (m_Memoized)
+        return m_RequireStack;
+
     if (StackIndex)
         return true;
 
@@ -65,7 +126,7 @@ mcc::Result mcc::Function::GenerateResult() const
 {
     return {
         .Type    = ResultType_::Value,
-        .Value   = '"' + Mangle().String() + '"',
+        .Value   = '"' + ResourceTable::GetString(GetMangledId()) + '"',
         .NotNull = true,
     };
 }
@@ -74,7 +135,7 @@ mcc::Result mcc::Function::GenerateResultUnwrap() const
 {
     return {
         .Type    = ResultType_::Value,
-        .Value   = Mangle().String(),
+        .Value   = ResourceTable::GetString(GetMangledId()),
         .NotNull = true,
     };
 }
@@ -121,9 +182,7 @@ bool mcc::Function::MergeConsecutiveBlocks()
                 successor->Predecessors.clear();
                 successor->Successors.clear();
 
-                for (const auto uses = successor->Uses; auto &use : uses)
-                    if (!use.expired())
-                        use.lock()->Replace(successor, block);
+                successor->ReplaceAllUsesWith(block);
 
                 blocks.insert(successor);
                 block->Successors.erase(successor);
@@ -138,6 +197,10 @@ bool mcc::Function::MergeConsecutiveBlocks()
 
 void mcc::Function::OptimizeBlocks()
 {
+    TraceSpan span("Function::OptimizeBlocks");
+    if (span)
+        span.Arg("function", Location.String()).Arg("blocks", Blocks.size()).Arg("instructions", count_instructions(Blocks));
+
     bool recycle;
     do
     {
@@ -146,11 +209,21 @@ void mcc::Function::OptimizeBlocks()
         recycle |= MergeConsecutiveBlocks();
     }
     while (recycle);
+
+    Memoize();
+
+    if (span)
+        span.Arg("blocks after", Blocks.size()).Arg("instructions after", count_instructions(Blocks));
 }
 
 void mcc::Function::GenerateFunction(Package &package) const
 {
+    TraceSpan span("Function::GenerateFunction");
+
     const auto require_stack = RequireStack();
+    const auto &location     = Mangle();
+
+    size_t command_count = 0;
 
     std::set<std::string> names;
     for (auto it = Blocks.begin(); it != Blocks.end(); ++it)
@@ -159,18 +232,17 @@ void mcc::Function::GenerateFunction(Package &package) const
 
         auto &block = *it;
 
-        auto location            = Mangle();
-        auto [namespace_, path_] = location;
+        auto id = GetMangledId();
         if (!first)
         {
             auto name = block->Name;
             for (unsigned i = 0; names.contains(name);)
                 name = block->Name + std::to_string(++i);
             names.insert(name);
-            path_.push_back(name);
+            id = ResourceTable::Intern(location.Child(name));
         }
 
-        CommandVector commands(package.Functions[namespace_][path_]);
+        CommandVector commands(package.Functions[id]);
 
         if (first && require_stack)
         {
@@ -196,7 +268,17 @@ void mcc::Function::GenerateFunction(Package &package) const
                block->GetLocation());
 
         block->Generate(commands, require_stack);
+        command_count += commands.Count();
+
+        if (const auto switch_ = std::dynamic_pointer_cast<SwitchInstruction>(block->GetTerminator()))
+            switch_->GenerateDispatch(package);
     }
+
+    if (span)
+        span.Arg("function", location.String())
+                .Arg("blocks", Blocks.size())
+                .Arg("instructions", count_instructions(Blocks))
+                .Arg("commands", command_count);
 }
 
 void mcc::Function::ForwardArguments(
@@ -222,15 +304,29 @@ void mcc::Function::ForwardArguments(
     arguments += '}';
 }
 
-mcc::ResourceLocation mcc::Function::Mangle() const
+const mcc::ResourceLocation &mcc::Function::Mangle() const
+{
+    return ResourceTable::Get(GetMangledId());
+}
+
+mcc::ResourceId mcc::Function::GetMangledId() const
 {
-    return ModuleRef.Mangle(Self.lock());
+    if (!m_MangledId)
+        m_MangledId = ResourceTable::Intern(ModuleRef.Mangle(Self.lock()));
+    return *m_MangledId;
 }
 
 mcc::ResourceLocation mcc::Function::GetLocation(const BlockPtr &target_block) const
 {
     Assert(!!target_block, Where, "target block must not be null");
 
+    if (m_Memoized)
+    {
+        if (const auto it = m_Locations.find(target_block.get()); it != m_Locations.end())
+            return it->second;
+        Error(target_block->Where, "target block is not owned by the function");
+    }
+
     std::set<std::string> names;
     for (auto &block : Blocks)
     {
@@ -250,7 +346,7 @@ mcc::BlockPtr mcc::Function::Erase(const BlockPtr &target_block)
 {
     Assert(!!target_block, Where, "target block must not be null");
     Assert(target_block->Predecessors.empty(), target_block->Where, "target block must not have any predecessors");
-    Assert(target_block->Uses.empty(), target_block->Where, "target block must not have any uses");
+    Assert(!target_block->HasUses(), target_block->Where, "target block must not have any uses");
 
     for (auto i = Blocks.begin(); i != Blocks.end(); ++i)
         if (*i == target_block)
@@ -262,8 +358,116 @@ mcc::BlockPtr mcc::Function::Erase(const BlockPtr &target_block)
             target_block->Successors.clear();
 
             target_block->Parent = nullptr;
+            ErasedBlocks.push_back(target_block);
+            Invalidate();
             return target_block;
         }
 
     Error(target_block->Where, "target block is not owned by the function");
 }
+
+void mcc::Function::Memoize()
+{
+    Invalidate();
+
+    const auto location = Mangle();
+
+    std::set<std::string> names;
+    for (auto &block : Blocks)
+    {
+        auto name = block->Name;
+        for (unsigned i = 0; names.contains(name);)
+            name = block->Name + std::to_string(++i);
+        names.insert(name);
+
+        m_Locations.emplace(block.get(), location.Child(name));
+    }
+
+    FuseConditions();
+    AllocateRegisters();
+
+    m_RequireStack = RequireStack();
+    m_Memoized     = true;
+}
+
+void mcc::Function::Invalidate()
+{
+    m_Memoized     = false;
+    m_RequireStack = false;
+    m_Locations.clear();
+    m_Registers.clear();
+    m_FusedConditions.clear();
+}
+
+std::optional<std::string> mcc::Function::GetRegister(const ValueBase *value) const
+{
+    if (const auto it = m_Registers.find(value); it != m_Registers.end())
+        return std::format("%r{}", it->second);
+    return std::nullopt;
+}
+
+bool mcc::Function::IsFusedCondition(const ValueBase *value) const
+{
+    return m_FusedConditions.contains(value);
+}
+
+void mcc::Function::FuseConditions()
+{
+    for (auto &block : Blocks)
+    {
+        auto &instructions = block->Instructions;
+        for (size_t i = 0; i + 1 < instructions.size(); ++i)
+        {
+            if (!dynamic_cast<ComparisonInstruction *>(instructions[i].get()))
+                continue;
+
+            const auto branch = dynamic_cast<BranchInstruction *>(instructions[i + 1].get());
+            if (!branch)
+                continue;
+
+            if (const auto use = instructions[i]->GetFirstUse(); use == &branch->Condition && !use->GetNext())
+                m_FusedConditions.insert(instructions[i].get());
+        }
+    }
+}
+
+void mcc::Function::AllocateRegisters()
+{
+    for (auto &block : Blocks)
+    {
+        auto &instructions = block->Instructions;
+
+        std::unordered_map<const ValueBase *, size_t> positions;
+        for (size_t i = 0; i < instructions.size(); ++i)
+            positions.emplace(instructions[i].get(), i);
+
+        std::vector<size_t> live;
+
+        for (size_t i = 0; i < instructions.size(); ++i)
+        {
+            auto &instruction = instructions[i];
+            if (!dynamic_cast<OperationInstruction *>(instruction.get())
+                && !dynamic_cast<ComparisonInstruction *>(instruction.get()))
+                continue;
+
+            if (m_FusedConditions.contains(instruction.get()))
+                continue;
+
+            const auto end = live_range_end(instructions, positions, i);
+            if (!end)
+                continue;
+
+            // registers last read by this instruction stay taken
+            unsigned index = 0;
+            while (index < live.size() && live[index] >= i)
+                ++index;
+
+            if (index == live.size())
+                live.push_back(*end);
+            else
+                live[index] = *end;
+
+            m_Registers.emplace(instruction.get(), index);
+        }
+    }
+}
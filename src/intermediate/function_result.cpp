@@ -7,7 +7,7 @@ mcc::ValuePtr mcc::FunctionResult::Create(
         const TypePtr &type,
         const FunctionPtr &parent)
 {
-    auto self  = std::make_shared<FunctionResult>(where, name, type, parent);
+    auto self  = MakeValue<FunctionResult>(where, name, type, parent);
     self->Self = self;
     return self;
 }
@@ -35,7 +35,7 @@ mcc::Result mcc::FunctionResult::GenerateResult() const
     return {
         .Type          = ResultType_::Reference,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
         .Path          = "result",
     };
 }
@@ -9,7 +9,7 @@ mcc::FunctionStorageReference::SPtr mcc::FunctionStorageReference::Create(
         const std::string &path,
         bool is_mutable)
 {
-    auto self  = std::make_shared<FunctionStorageReference>(where, name, type, parent, path, is_mutable);
+    auto self  = MakeValue<FunctionStorageReference>(where, name, type, parent, path, is_mutable);
     self->Self = self;
     return self;
 }
@@ -45,7 +45,7 @@ mcc::Result mcc::FunctionStorageReference::GenerateResult() const
         .Type          = ResultType_::Reference,
         .WithArgument  = false,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
         .Path          = Path,
     };
 }
@@ -8,7 +8,8 @@ mcc::Instruction::Instruction(
     : Value(where,
             name,
             type,
-            field_type)
+            field_type,
+            true)
 {
 }
 
@@ -19,20 +20,10 @@ bool mcc::Instruction::IsTerminator() const
 
 std::string mcc::Instruction::GetStackPath() const
 {
-    return std::format("stack[0].x{}", StackId);
+    return std::format("stack[0].x{}", GetStackId());
 }
 
 std::string mcc::Instruction::GetTemp() const
 {
-    return std::format("x{}", StackId);
-}
-
-std::string mcc::Instruction::CreateScore() const
-{
-    return std::format("scoreboard objectives add x{} dummy", StackId);
-}
-
-std::string mcc::Instruction::RemoveScore() const
-{
-    return std::format("scoreboard objectives remove x{}", StackId);
+    return std::format("x{}", GetStackId());
 }
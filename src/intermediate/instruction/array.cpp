@@ -44,13 +44,8 @@ mcc::ArrayInstruction::SPtr mcc::ArrayInstruction::Create(
         const ValuePtr &value,
         IndexT index)
 {
-    auto self = std::make_shared<ArrayInstruction>(where, name, context, array_operation, array, value, index);
-
+    auto self  = MakeValue<ArrayInstruction>(where, name, context, array_operation, array, value, index);
     self->Self = self;
-    self->Array->Use(self);
-    if (self->Value)
-        self->Value->Use(self);
-
     return self;
 }
 
@@ -68,19 +63,12 @@ mcc::ArrayInstruction::ArrayInstruction(
               context.GetVoid(),
               FieldType_::Value),
       ArrayOperation(array_operation),
-      Array(std::move(array)),
-      Value(std::move(value)),
+      Array(this, std::move(array)),
+      Value(this, std::move(value)),
       Index(index)
 {
 }
 
-mcc::ArrayInstruction::~ArrayInstruction()
-{
-    Array->Drop(Self);
-    if (Value)
-        Value->Drop(Self);
-}
-
 void mcc::ArrayInstruction::Generate(
         CommandVector &commands,
         bool stack) const
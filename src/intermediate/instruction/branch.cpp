@@ -14,13 +14,8 @@ mcc::InstructionPtr mcc::BranchInstruction::Create(
         const BlockPtr &then_target,
         const BlockPtr &else_target)
 {
-    auto self = std::make_shared<BranchInstruction>(where, name, context, parent, condition, then_target, else_target);
-
+    auto self  = MakeValue<BranchInstruction>(where, name, context, parent, condition, then_target, else_target);
     self->Self = self;
-    self->Condition->Use(self);
-    self->ThenTarget->Use(self);
-    self->ElseTarget->Use(self);
-
     return self;
 }
 
@@ -38,17 +33,10 @@ mcc::BranchInstruction::BranchInstruction(
               context.GetVoid(),
               FieldType_::Value),
       Parent(std::move(parent)),
-      Condition(std::move(condition)),
-      ThenTarget(std::move(then_target)),
-      ElseTarget(std::move(else_target))
-{
-}
-
-mcc::BranchInstruction::~BranchInstruction()
+      Condition(this, std::move(condition)),
+      ThenTarget(this, std::move(then_target)),
+      ElseTarget(this, std::move(else_target))
 {
-    Condition->Drop(Self);
-    ThenTarget->Drop(Self);
-    ElseTarget->Drop(Self);
 }
 
 void mcc::BranchInstruction::Generate(
@@ -61,11 +49,19 @@ void mcc::BranchInstruction::Generate(
     Parent->ForwardArguments(prefix, arguments);
 
     auto stack_path = GetStackPath();
-    auto temp       = GetTemp();
 
     auto then_target = ThenTarget->GetLocation();
     auto else_target = ElseTarget->GetLocation();
 
+    if (Parent->IsFusedCondition(Condition.Get().get()))
+    {
+        const auto &comparison = dynamic_cast<const ComparisonInstruction &>(*Condition.Get());
+        const auto condition   = comparison.GenerateCondition(commands, prefix);
+        commands.Append("{}execute {} run return run function {}{}", prefix, condition, then_target, arguments);
+        commands.Append("{}return run function {}{}", prefix, else_target, arguments);
+        return;
+    }
+
     switch (auto condition = Condition->GenerateResult(); condition.Type)
     {
     case ResultType_::Value:
@@ -73,21 +69,19 @@ void mcc::BranchInstruction::Generate(
         break;
 
     case ResultType_::Reference:
-        commands.Append(CreateScore());
         commands.Append(
                 "{}execute store result score %c {} run data get {} {} {}",
                 condition.WithArgument ? "$" : "",
-                temp,
+                RegisterObjective,
                 condition.ReferenceType,
                 condition.Target,
                 condition.Path);
         commands.Append("data remove storage {} {}", location, stack_path);
         commands.Append(
                 "execute unless score %c {} matches 0 run data modify storage {} {} set value 1",
-                temp,
+                RegisterObjective,
                 location,
                 stack_path);
-        commands.Append(RemoveScore());
 
         commands.Append(
                 "{}execute if data storage {} {} run return run function {}{}",
@@ -100,15 +94,13 @@ void mcc::BranchInstruction::Generate(
         break;
 
     case ResultType_::Argument:
-        commands.Append(CreateScore());
-        commands.Append("$scoreboard players set %c {} {}", temp, condition.Name);
+        commands.Append("$scoreboard players set %c {} {}", RegisterObjective, condition.Name);
         commands.Append("data remove storage {} {}", location, stack_path);
         commands.Append(
                 "execute unless score %c {} matches 0 run data modify storage {} {} set value 1",
-                temp,
+                RegisterObjective,
                 location,
                 stack_path);
-        commands.Append(RemoveScore());
 
         commands.Append(
                 "{}execute if data storage {} {} run return run function {}{}",
@@ -120,19 +112,32 @@ void mcc::BranchInstruction::Generate(
         commands.Append("{}return run function {}{}", prefix, else_target, arguments);
         break;
 
+    case ResultType_::Score:
+        commands.Append(
+                "{}execute unless score {} {} matches 0 run return run function {}{}",
+                prefix,
+                condition.Player,
+                condition.Objective,
+                then_target,
+                arguments);
+        commands.Append("{}return run function {}{}", prefix, else_target, arguments);
+        break;
+
     default:
         Error(Where,
-              "condition must be {}, {} or {}, but is {}",
+              "condition must be {}, {}, {} or {}, but is {}",
               ResultType_::Value,
               ResultType_::Reference,
               ResultType_::Argument,
+              ResultType_::Score,
               condition.Type);
     }
 }
 
 bool mcc::BranchInstruction::RequireStack() const
 {
-    return true;
+    const auto condition = Condition.Get().get();
+    return !Parent->GetRegister(condition) && !Parent->IsFusedCondition(condition);
 }
 
 bool mcc::BranchInstruction::IsTerminator() const
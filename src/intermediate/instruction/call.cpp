@@ -19,14 +19,8 @@ mcc::InstructionPtr mcc::CallInstruction::Create(
         >> &arguments,
         const BlockPtr &landing_pad)
 {
-    auto self = std::make_shared<CallInstruction>(where, name, parent, callee, arguments, landing_pad);
-
+    auto self  = MakeValue<CallInstruction>(where, name, parent, callee, arguments, landing_pad);
     self->Self = self;
-    for (const auto &argument : self->Arguments | std::views::values)
-        argument->Use(self);
-    if (self->LandingPad)
-        self->LandingPad->Use(self);
-
     return self;
 }
 
@@ -47,17 +41,14 @@ mcc::CallInstruction::CallInstruction(
               FieldType_::ImmutableReference),
       Parent(std::move(parent)),
       Callee(callee),
-      Arguments(arguments),
-      LandingPad(std::move(landing_pad))
-{
-}
-
-mcc::CallInstruction::~CallInstruction()
+      LandingPad(this, std::move(landing_pad))
 {
-    for (const auto &argument : Arguments | std::views::values)
-        argument->Drop(Self);
-    if (LandingPad)
-        LandingPad->Drop(Self);
+    Arguments.reserve(arguments.size());
+    for (auto &[key_, argument_] : arguments)
+        Arguments.emplace_back(
+                std::piecewise_construct,
+                std::forward_as_tuple(key_),
+                std::forward_as_tuple(this, argument_));
 }
 
 void mcc::CallInstruction::Generate(
@@ -67,7 +58,6 @@ void mcc::CallInstruction::Generate(
     auto location = Parent->Mangle();
 
     auto stack_path = GetStackPath();
-    auto temp       = GetTemp();
 
     std::string argument_prefix;
     std::string argument_object;
@@ -78,8 +68,8 @@ void mcc::CallInstruction::Generate(
                 Arguments | std::views::values,
                 [](auto &argument)
                 {
-                    return std::dynamic_pointer_cast<Constant>(argument)
-                           || std::dynamic_pointer_cast<ArgumentValue>(argument);
+                    return std::dynamic_pointer_cast<Constant>(argument.Get())
+                           || std::dynamic_pointer_cast<ArgumentValue>(argument.Get());
                 });
 
         if (constant)
@@ -91,7 +81,7 @@ void mcc::CallInstruction::Generate(
                 if (i)
                     argument_object += ',';
 
-                auto [key, argument] = Arguments[i];
+                auto &[key, argument] = Arguments[i];
 
                 if (auto value = argument->GenerateResult(); value.Type == ResultType_::Argument)
                 {
@@ -185,20 +175,18 @@ void mcc::CallInstruction::Generate(
 
     if (Callee->Throws)
     {
-        commands.Append(CreateScore());
         commands.Append(
                 "{}execute store result score %c {} run function {}{}",
                 argument_prefix,
-                temp,
+                RegisterObjective,
                 callee,
                 argument_object);
         commands.Append("data remove storage {} {}", location, stack_path);
         commands.Append(
                 "execute unless score %c {} matches 0 run data modify storage {} {} set value 1",
-                temp,
+                RegisterObjective,
                 location,
                 stack_path);
-        commands.Append(RemoveScore());
 
         commands.Append("data remove storage {} result", location);
         commands.Append(
@@ -229,7 +217,7 @@ void mcc::CallInstruction::Generate(
     else
         commands.Append("{}function {}{}", argument_prefix, callee, argument_object);
 
-    if (!Uses.empty())
+    if (HasUses())
     {
         Assert(stack, Where, "call instruction with result requires stack");
         commands.Append("data modify storage {} {} set from storage {} result", location, stack_path, callee);
@@ -240,7 +228,7 @@ void mcc::CallInstruction::Generate(
 
 bool mcc::CallInstruction::RequireStack() const
 {
-    return !Uses.empty()
+    return HasUses()
            || std::ranges::any_of(
                    Arguments | std::views::values,
                    [](auto &argument) { return argument->RequireStack(); })
@@ -248,8 +236,8 @@ bool mcc::CallInstruction::RequireStack() const
                    Arguments | std::views::values,
                    [](auto &argument)
                    {
-                       return std::dynamic_pointer_cast<Constant>(argument)
-                              || std::dynamic_pointer_cast<ArgumentValue>(argument);
+                       return std::dynamic_pointer_cast<Constant>(argument.Get())
+                              || std::dynamic_pointer_cast<ArgumentValue>(argument.Get());
                    });
 }
 
@@ -258,7 +246,7 @@ mcc::Result mcc::CallInstruction::GenerateResult() const
     return {
         .Type          = ResultType_::Reference,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
         .Path          = GetStackPath(),
     };
 }
@@ -10,7 +10,7 @@ mcc::InstructionPtr mcc::CommandInstruction::Create(
         const FunctionPtr &parent,
         const CommandT &command)
 {
-    auto self  = std::make_shared<CommandInstruction>(where, name, type, parent, command);
+    auto self  = MakeValue<CommandInstruction>(where, name, type, parent, command);
     self->Self = self;
     return self;
 }
@@ -35,7 +35,7 @@ void mcc::CommandInstruction::Generate(
         CommandVector &commands,
         const bool stack) const
 {
-    if (Uses.empty())
+    if (!HasUses())
     {
         commands.Append(Command);
         return;
@@ -58,7 +58,7 @@ void mcc::CommandInstruction::Generate(
 
 bool mcc::CommandInstruction::RequireStack() const
 {
-    return !Uses.empty();
+    return HasUses();
 }
 
 mcc::Result mcc::CommandInstruction::GenerateResult() const
@@ -66,7 +66,7 @@ mcc::Result mcc::CommandInstruction::GenerateResult() const
     return {
         .Type          = ResultType_::Reference,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
         .Path          = GetStackPath(),
     };
 }
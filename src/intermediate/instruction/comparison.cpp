@@ -1,9 +1,12 @@
 #include <mcc/command.hpp>
+#include <mcc/constant.hpp>
 #include <mcc/error.hpp>
 #include <mcc/function.hpp>
 #include <mcc/instruction.hpp>
 #include <mcc/type.hpp>
 
+#include <limits>
+
 mcc::InstructionPtr mcc::ComparisonInstruction::Create(
         const SourceLocation &where,
         const std::string &name,
@@ -13,12 +16,8 @@ mcc::InstructionPtr mcc::ComparisonInstruction::Create(
         const ValuePtr &left,
         const ValuePtr &right)
 {
-    auto self = std::make_shared<ComparisonInstruction>(where, name, context, comparator, parent, left, right);
-
+    auto self  = MakeValue<ComparisonInstruction>(where, name, context, comparator, parent, left, right);
     self->Self = self;
-    self->Left->Use(self);
-    self->Right->Use(self);
-
     return self;
 }
 
@@ -37,99 +36,215 @@ mcc::ComparisonInstruction::ComparisonInstruction(
               FieldType_::Value),
       Comparator(comparator),
       Parent(std::move(parent)),
-      Left(std::move(left)),
-      Right(std::move(right))
+      Left(this, std::move(left)),
+      Right(this, std::move(right))
 {
 }
 
-mcc::ComparisonInstruction::~ComparisonInstruction()
+static mcc::Comparator_ swap_comparator(const mcc::Comparator_ comparator)
 {
-    Left->Drop(Self);
-    Right->Drop(Self);
+    switch (comparator)
+    {
+    case mcc::Comparator_::LT:
+        return mcc::Comparator_::GT;
+    case mcc::Comparator_::GT:
+        return mcc::Comparator_::LT;
+    case mcc::Comparator_::LE:
+        return mcc::Comparator_::GE;
+    case mcc::Comparator_::GE:
+        return mcc::Comparator_::LE;
+    default:
+        return comparator;
+    }
 }
 
-void mcc::ComparisonInstruction::Generate(
-        CommandVector &commands,
-        bool stack) const
+// arguments only work for inclusive bounds, as a macro cannot be offset by one
+static std::optional<std::string> range_test(
+        const mcc::Comparator_ comparator,
+        const mcc::ValuePtr &bound,
+        std::string &prefix)
 {
-    auto left  = Left->GenerateResult();
-    auto right = Right->GenerateResult();
+    if (const auto constant = std::dynamic_pointer_cast<mcc::ConstantNumber>(bound))
+    {
+        constexpr auto min = std::numeric_limits<std::int32_t>::min();
+        constexpr auto max = std::numeric_limits<std::int32_t>::max();
 
-    const auto require_right = Left != Right && left != right;
+        const auto value = constant->Value;
+        if (value < min || value > max)
+            return std::nullopt;
+
+        switch (comparator)
+        {
+        case mcc::Comparator_::LT:
+            if (value == min)
+                return std::nullopt;
+            return std::format("..{}", value - 1);
+        case mcc::Comparator_::GT:
+            if (value == max)
+                return std::nullopt;
+            return std::format("{}..", value + 1);
+        case mcc::Comparator_::LE:
+            return std::format("..{}", value);
+        case mcc::Comparator_::GE:
+            return std::format("{}..", value);
+        case mcc::Comparator_::EQ:
+            return std::format("{}", value);
+        default:
+            return std::nullopt;
+        }
+    }
 
-    auto objective = GetTemp();
+    const auto result = bound->GenerateResult();
+    if (result.Type != mcc::ResultType_::Argument)
+        return std::nullopt;
+
+    std::optional<std::string> range;
+    switch (comparator)
+    {
+    case mcc::Comparator_::LE:
+        range = ".." + result.Name;
+        break;
+    case mcc::Comparator_::GE:
+        range = result.Name + "..";
+        break;
+    case mcc::Comparator_::EQ:
+        range = result.Name;
+        break;
+    default:
+        return std::nullopt;
+    }
 
-    commands.Append(CreateScore());
+    prefix = "$";
+    return range;
+}
 
+static std::pair<std::string, std::string> load_score(
+        const mcc::ComparisonInstruction &self,
+        mcc::CommandVector &commands,
+        const mcc::Result &operand,
+        const std::string &player,
+        const std::string &objective)
+{
     std::string prefix;
-    if (left.WithArgument)
+    if (operand.WithArgument)
         prefix = "$";
 
-    switch (left.Type)
+    switch (operand.Type)
     {
-    case ResultType_::Value:
-        commands.Append("{}scoreboard players set %a {} {}", prefix, objective, left.Value);
+    case mcc::ResultType_::Value:
+        commands.Append("{}scoreboard players set {} {} {}", prefix, player, objective, operand.Value);
         break;
 
-    case ResultType_::Reference:
+    case mcc::ResultType_::Reference:
         commands.Append(
-                "{}execute store result score %a {} run data get {} {} {}",
+                "{}execute store result score {} {} run data get {} {} {}",
                 prefix,
+                player,
                 objective,
-                left.ReferenceType,
-                left.Target,
-                left.Path);
+                operand.ReferenceType,
+                operand.Target,
+                operand.Path);
         break;
 
-    case ResultType_::Argument:
-        commands.Append("$scoreboard players set %a {} {}", objective, left.Name);
+    case mcc::ResultType_::Argument:
+        commands.Append("$scoreboard players set {} {} {}", player, objective, operand.Name);
         break;
 
+    case mcc::ResultType_::Score:
+        return { operand.Player, operand.Objective };
+
     default:
-        Error(Where,
-              "left must be {}, {} or {}, but is {}",
-              ResultType_::Value,
-              ResultType_::Reference,
-              ResultType_::Argument,
-              left.Type);
+        mcc::Error(
+                self.Where,
+                "operand must be {}, {}, {} or {}, but is {}",
+                mcc::ResultType_::Value,
+                mcc::ResultType_::Reference,
+                mcc::ResultType_::Argument,
+                mcc::ResultType_::Score,
+                operand.Type);
     }
 
-    if (require_right)
+    return { player, objective };
+}
+
+void mcc::ComparisonInstruction::Generate(
+        CommandVector &commands,
+        bool stack) const
+{
+    if (Parent->IsFusedCondition(this))
+        return;
+
+    std::string prefix;
+    const auto condition = GenerateCondition(commands, prefix);
+
+    if (const auto register_ = Parent->GetRegister(this))
     {
-        prefix = "";
-        if (right.WithArgument)
-            prefix = "$";
+        commands.Append("{}execute store result score {} {} {}", prefix, *register_, RegisterObjective, condition);
+        return;
+    }
 
-        switch (right.Type)
-        {
-        case ResultType_::Value:
-            commands.Append("{}scoreboard players set %b {} {}", prefix, objective, right.Value);
-            break;
-
-        case ResultType_::Reference:
-            commands.Append(
-                    "{}execute store result score %b {} run data get {} {} {}",
-                    prefix,
-                    objective,
-                    right.ReferenceType,
-                    right.Target,
-                    right.Path);
-            break;
-
-        case ResultType_::Argument:
-            commands.Append("$scoreboard players set %b {} {}", objective, right.Name);
-            break;
+    Assert(stack, Where, "comparison instruction requires stack");
+    commands.Append(
+            "{}execute store result storage {} {} byte 1 {}",
+            prefix,
+            Parent->Mangle(),
+            GetStackPath(),
+            condition);
+}
 
-        default:
-            Error(Where,
-                  "right must be {}, {} or {}, but is {}",
-                  ResultType_::Value,
-                  ResultType_::Reference,
-                  ResultType_::Argument,
-                  right.Type);
-        }
+bool mcc::ComparisonInstruction::RequireStack() const
+{
+    if (!Parent->GetRegister(this) && !Parent->IsFusedCondition(this))
+        return true;
+
+    return Left->RequireStack() || Right->RequireStack();
+}
+
+mcc::Result mcc::ComparisonInstruction::GenerateResult() const
+{
+    if (auto register_ = Parent->GetRegister(this))
+        return {
+            .Type      = ResultType_::Score,
+            .Player    = std::move(*register_),
+            .Objective = RegisterObjective,
+            .StoreType = "byte",
+        };
+
+    return {
+        .Type          = ResultType_::Reference,
+        .ReferenceType = ReferenceType_::Storage,
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
+        .Path          = GetStackPath(),
+    };
+}
+
+std::string mcc::ComparisonInstruction::GenerateCondition(
+        CommandVector &commands,
+        std::string &prefix) const
+{
+    if (auto range = range_test(Comparator, Right, prefix))
+    {
+        auto [player_, objective_] = load_score(*this, commands, Left->GenerateResult(), "%a", RegisterObjective);
+        return std::format("if score {} {} matches {}", player_, objective_, *range);
     }
 
+    if (auto range = range_test(swap_comparator(Comparator), Left, prefix))
+    {
+        auto [player_, objective_] = load_score(*this, commands, Right->GenerateResult(), "%a", RegisterObjective);
+        return std::format("if score {} {} matches {}", player_, objective_, *range);
+    }
+
+    auto left  = Left->GenerateResult();
+    auto right = Right->GenerateResult();
+
+    const auto require_right = Left != Right && left != right;
+
+    auto [left_player, left_objective] = load_score(*this, commands, left, "%a", RegisterObjective);
+
+    auto [right_player, right_objective] = require_right
+                                                   ? load_score(*this, commands, right, "%b", RegisterObjective)
+                                                   : std::pair(left_player, left_objective);
+
     std::string operator_;
     switch (Comparator)
     {
@@ -157,30 +272,11 @@ void mcc::ComparisonInstruction::Generate(
         Error(Where, "undefined comparator {}", Comparator);
     }
 
-    Assert(stack, Where, "comparison instruction requires stack");
-    commands.Append(
-            "execute store result storage {} {} byte 1 if score %a {} {} {} {}",
-            Parent->Mangle(),
-            GetStackPath(),
-            objective,
+    return std::format(
+            "if score {} {} {} {} {}",
+            left_player,
+            left_objective,
             operator_,
-            require_right ? "%b" : "%a",
-            objective);
-
-    commands.Append(RemoveScore());
-}
-
-bool mcc::ComparisonInstruction::RequireStack() const
-{
-    return true;
-}
-
-mcc::Result mcc::ComparisonInstruction::GenerateResult() const
-{
-    return {
-        .Type          = ResultType_::Reference,
-        .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
-        .Path          = GetStackPath(),
-    };
+            right_player,
+            right_objective);
 }
@@ -10,11 +10,8 @@ mcc::InstructionPtr mcc::DeleteInstruction::Create(
         Context &context,
         const ValuePtr &value)
 {
-    auto self = std::make_shared<DeleteInstruction>(where, name, context, value);
-
+    auto self  = MakeValue<DeleteInstruction>(where, name, context, value);
     self->Self = self;
-    self->Value->Use(self);
-
     return self;
 }
 
@@ -28,13 +25,8 @@ mcc::DeleteInstruction::DeleteInstruction(
               name,
               context.GetVoid(),
               FieldType_::Value),
-      Value(std::move(value))
-{
-}
-
-mcc::DeleteInstruction::~DeleteInstruction()
+      Value(this, std::move(value))
 {
-    Value->Drop(Self);
 }
 
 void mcc::DeleteInstruction::Generate(
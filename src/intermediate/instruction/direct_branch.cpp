@@ -24,15 +24,8 @@ mcc::InstructionPtr mcc::DirectBranchInstruction::Create(
         const ValuePtr &result,
         const ValuePtr &branch_result)
 {
-    auto self = std::make_shared<DirectBranchInstruction>(where, name, context, parent, target, result, branch_result);
-
+    auto self  = MakeValue<DirectBranchInstruction>(where, name, context, parent, target, result, branch_result);
     self->Self = self;
-    self->Target->Use(self);
-    if (self->Result)
-        self->Result->Use(self);
-    if (self->BranchResult)
-        self->BranchResult->Use(self);
-
     return self;
 }
 
@@ -50,19 +43,10 @@ mcc::DirectBranchInstruction::DirectBranchInstruction(
               context.GetVoid(),
               FieldType_::Value),
       Parent(std::move(parent)),
-      Target(std::move(target)),
-      Result(std::move(result)),
-      BranchResult(std::move(branch_result))
-{
-}
-
-mcc::DirectBranchInstruction::~DirectBranchInstruction()
+      Target(this, std::move(target)),
+      Result(this, std::move(result)),
+      BranchResult(this, std::move(branch_result))
 {
-    Target->Drop(Self);
-    if (Result)
-        Result->Drop(Self);
-    if (BranchResult)
-        BranchResult->Drop(Self);
 }
 
 void mcc::DirectBranchInstruction::Generate(
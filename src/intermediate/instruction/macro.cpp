@@ -13,7 +13,7 @@ static void generate_macro_print(
 {
     mcc::Assert(self.Arguments.size() == 2, self.Where, "argument count must be 2, but is {}", self.Arguments.size());
 
-    const auto targets = std::dynamic_pointer_cast<mcc::ConstantString>(self.Arguments[0])->Value;
+    const auto targets = std::dynamic_pointer_cast<mcc::ConstantString>(self.Arguments[0].Get())->Value;
     const auto message = self.Arguments[1]->GenerateResult();
 
     std::string message_value, prefix;
@@ -120,8 +120,8 @@ static void generate_macro_data(
 {
     mcc::Assert(self.Arguments.size() == 2, self.Where, "argument count must be 2, but is {}", self.Arguments.size());
 
-    const auto dst = self.Arguments[0];
-    const auto src = self.Arguments[1];
+    const auto &dst = self.Arguments[0].Get();
+    const auto &src = self.Arguments[1].Get();
 
     mcc::Assert(dst->IsMutable(), self.Where, "dst must be mutable");
 
@@ -154,8 +154,8 @@ static void generate_macro_store(
 {
     mcc::Assert(self.Arguments.size() == 2, self.Where, "argument count must be 2, but is {}", self.Arguments.size());
 
-    const auto dst = self.Arguments[0];
-    const auto src = self.Arguments[1];
+    const auto &dst = self.Arguments[0].Get();
+    const auto &src = self.Arguments[1].Get();
 
     mcc::Assert(dst->IsMutable(), self.Where, "dst must be mutable");
 
@@ -199,12 +199,8 @@ mcc::InstructionPtr mcc::MacroInstruction::Create(
         const std::string &macro,
         const std::vector<ValuePtr> &arguments)
 {
-    auto self = std::make_shared<MacroInstruction>(where, name, context, parent, macro, arguments);
-
+    auto self  = MakeValue<MacroInstruction>(where, name, context, parent, macro, arguments);
     self->Self = self;
-    for (const auto &argument : self->Arguments)
-        argument->Use(self);
-
     return self;
 }
 
@@ -221,15 +217,11 @@ mcc::MacroInstruction::MacroInstruction(
               context.GetVoid(),
               FieldType_::Value),
       Parent(std::move(parent)),
-      Macro(std::move(macro)),
-      Arguments(arguments)
-{
-}
-
-mcc::MacroInstruction::~MacroInstruction()
+      Macro(std::move(macro))
 {
-    for (const auto &argument : Arguments)
-        argument->Drop(Self);
+    Arguments.reserve(arguments.size());
+    for (auto &argument : arguments)
+        Arguments.emplace_back(this, argument);
 }
 
 void mcc::MacroInstruction::Generate(
@@ -11,11 +11,8 @@ mcc::InstructionPtr mcc::NotNullInstruction::Create(
         const FunctionPtr &parent,
         const ValuePtr &value)
 {
-    auto self = std::make_shared<NotNullInstruction>(where, name, context, parent, value);
-
+    auto self  = MakeValue<NotNullInstruction>(where, name, context, parent, value);
     self->Self = self;
-    self->Value->Use(self);
-
     return self;
 }
 
@@ -31,13 +28,8 @@ mcc::NotNullInstruction::NotNullInstruction(
               context.GetNumber(),
               FieldType_::ImmutableReference),
       Parent(std::move(parent)),
-      Value(std::move(value))
-{
-}
-
-mcc::NotNullInstruction::~NotNullInstruction()
+      Value(this, std::move(value))
 {
-    Value->Drop(Self);
 }
 
 void mcc::NotNullInstruction::Generate(
@@ -72,7 +64,7 @@ void mcc::NotNullInstruction::Generate(
 
 bool mcc::NotNullInstruction::RequireStack() const
 {
-    return !Uses.empty() || Value->RequireStack();
+    return HasUses() || Value->RequireStack();
 }
 
 mcc::Result mcc::NotNullInstruction::GenerateResult() const
@@ -80,7 +72,7 @@ mcc::Result mcc::NotNullInstruction::GenerateResult() const
     return {
         .Type          = ResultType_::Reference,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
         .Path          = GetStackPath(),
     };
 }
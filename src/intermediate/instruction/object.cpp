@@ -11,12 +11,8 @@ mcc::InstructionPtr mcc::ObjectInstruction::CreateInsert(
         const ValuePtr &value,
         const std::string &key)
 {
-    auto self = std::make_shared<ObjectInstruction>(where, name, context, object, value, key);
-
+    auto self  = MakeValue<ObjectInstruction>(where, name, context, object, value, key);
     self->Self = self;
-    self->Object->Use(self);
-    self->Value->Use(self);
-
     return self;
 }
 
@@ -32,18 +28,12 @@ mcc::ObjectInstruction::ObjectInstruction(
               name,
               context.GetVoid(),
               FieldType_::Value),
-      Object(std::move(object)),
-      Value(std::move(value)),
+      Object(this, std::move(object)),
+      Value(this, std::move(value)),
       Key(std::move(key))
 {
 }
 
-mcc::ObjectInstruction::~ObjectInstruction()
-{
-    Object->Drop(Self);
-    Value->Drop(Self);
-}
-
 void mcc::ObjectInstruction::Generate(
         CommandVector &commands,
         bool stack) const
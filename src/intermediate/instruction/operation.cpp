@@ -4,6 +4,8 @@
 #include <mcc/instruction.hpp>
 #include <mcc/type.hpp>
 
+#include <algorithm>
+
 mcc::InstructionPtr mcc::OperationInstruction::Create(
         const SourceLocation &where,
         const std::string &name,
@@ -12,12 +14,8 @@ mcc::InstructionPtr mcc::OperationInstruction::Create(
         const FunctionPtr &parent,
         const std::vector<ValuePtr> &operands)
 {
-    auto self = std::make_shared<OperationInstruction>(where, name, context, operator_, parent, operands);
-
+    auto self  = MakeValue<OperationInstruction>(where, name, context, operator_, parent, operands);
     self->Self = self;
-    for (const auto &operand : self->Operands)
-        operand->Use(self);
-
     return self;
 }
 
@@ -34,24 +32,21 @@ mcc::OperationInstruction::OperationInstruction(
               context.GetNumber(),
               FieldType_::Value),
       Operator(operator_),
-      Parent(std::move(parent)),
-      Operands(operands)
+      Parent(std::move(parent))
 {
-}
-
-mcc::OperationInstruction::~OperationInstruction()
-{
-    for (const auto &operand : Operands)
-        operand->Drop(Self);
+    Operands.reserve(operands.size());
+    for (auto &operand : operands)
+        Operands.emplace_back(this, operand);
 }
 
 void mcc::OperationInstruction::Generate(
         CommandVector &commands,
         const bool stack) const
 {
-    auto objective = GetTemp();
+    const auto register_ = Parent->GetRegister(this);
 
-    commands.Append(CreateScore());
+    const std::string objective = RegisterObjective;
+    const auto target           = register_ ? *register_ : "%a";
 
     std::string operator_;
     switch (Operator)
@@ -83,12 +78,14 @@ void mcc::OperationInstruction::Generate(
     ValuePtr pre_operand_value;
     Result pre_operand;
 
+    std::string source_player, source_objective;
+
     for (unsigned i = 0; i < Operands.size(); ++i)
     {
-        auto player = i == 0 ? "%a" : "%b";
+        auto player = i == 0 ? target : "%b";
 
-        auto operand_value = Operands[i];
-        auto operand       = operand_value->GenerateResult();
+        auto &operand_value = Operands[i].Get();
+        auto operand        = operand_value->GenerateResult();
 
         auto require_operand = operand_value != pre_operand_value && operand != pre_operand;
 
@@ -97,6 +94,9 @@ void mcc::OperationInstruction::Generate(
 
         if (require_operand)
         {
+            source_player    = player;
+            source_objective = objective;
+
             std::string prefix;
             if (operand.WithArgument)
                 prefix = "$";
@@ -122,12 +122,29 @@ void mcc::OperationInstruction::Generate(
                 commands.Append("$scoreboard players set {} {} {}", player, objective, operand.Name);
                 break;
 
+            case ResultType_::Score:
+                if (i == 0)
+                {
+                    commands.Append(
+                            "scoreboard players operation {} {} = {} {}",
+                            player,
+                            objective,
+                            operand.Player,
+                            operand.Objective);
+                    break;
+                }
+
+                source_player    = operand.Player;
+                source_objective = operand.Objective;
+                break;
+
             default:
                 Error(Where,
-                      "operand must be {}, {} or {}, but is {}",
+                      "operand must be {}, {}, {} or {}, but is {}",
                       ResultType_::Value,
                       ResultType_::Reference,
                       ResultType_::Argument,
+                      ResultType_::Score,
                       operand.Type);
             }
         }
@@ -135,36 +152,48 @@ void mcc::OperationInstruction::Generate(
         if (i)
         {
             commands.Append(
-                    "scoreboard players operation %a {0} {1} {2} {0}",
+                    "scoreboard players operation {} {} {} {} {}",
+                    target,
                     objective,
                     operator_,
-                    require_operand ? "%b"
-                    : i > 1         ? "%b"
-                                    : "%a");
+                    source_player,
+                    source_objective);
         }
     }
 
+    if (register_)
+        return;
+
     Assert(stack, Where, "operation instruction requires stack");
     commands.Append(
             "execute store result storage {} {} long 1 run scoreboard players get %a {}",
             Parent->Mangle(),
             GetStackPath(),
             objective);
-
-    commands.Append(RemoveScore());
 }
 
 bool mcc::OperationInstruction::RequireStack() const
 {
-    return true;
+    if (!Parent->GetRegister(this))
+        return true;
+
+    return std::ranges::any_of(Operands, [](const auto &operand) { return operand->RequireStack(); });
 }
 
 mcc::Result mcc::OperationInstruction::GenerateResult() const
 {
+    if (auto register_ = Parent->GetRegister(this))
+        return {
+            .Type      = ResultType_::Score,
+            .Player    = std::move(*register_),
+            .Objective = RegisterObjective,
+            .StoreType = "long",
+        };
+
     return {
         .Type          = ResultType_::Reference,
         .ReferenceType = ReferenceType_::Storage,
-        .Target        = Parent->Mangle().String(),
+        .Target        = ResourceTable::GetString(Parent->GetMangledId()),
         .Path          = GetStackPath(),
     };
 }
@@ -11,12 +11,8 @@ mcc::InstructionPtr mcc::ReturnInstruction::Create(
         const FunctionPtr &parent,
         const ValuePtr &value)
 {
-    auto self = std::make_shared<ReturnInstruction>(where, name, context, parent, value);
-
+    auto self  = MakeValue<ReturnInstruction>(where, name, context, parent, value);
     self->Self = self;
-    if (self->Value)
-        self->Value->Use(self);
-
     return self;
 }
 
@@ -32,14 +28,8 @@ mcc::ReturnInstruction::ReturnInstruction(
               context.GetVoid(),
               FieldType_::Value),
       Parent(std::move(parent)),
-      Value(std::move(value))
-{
-}
-
-mcc::ReturnInstruction::~ReturnInstruction()
+      Value(this, std::move(value))
 {
-    if (Value)
-        Value->Drop(Self);
 }
 
 void mcc::ReturnInstruction::Generate(
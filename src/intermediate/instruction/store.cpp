@@ -8,12 +8,8 @@ mcc::InstructionPtr mcc::StoreInstruction::Create(
         const ValuePtr &dst,
         const ValuePtr &src)
 {
-    auto self = std::make_shared<StoreInstruction>(where, name, dst, src);
-
+    auto self  = MakeValue<StoreInstruction>(where, name, dst, src);
     self->Self = self;
-    self->Dst->Use(self);
-    self->Src->Use(self);
-
     return self;
 }
 
@@ -27,15 +23,9 @@ mcc::StoreInstruction::StoreInstruction(
               name,
               dst->Type,
               dst->FieldType),
-      Dst(dst),
-      Src(std::move(src))
-{
-}
-
-mcc::StoreInstruction::~StoreInstruction()
+      Dst(this, dst),
+      Src(this, std::move(src))
 {
-    Dst->Drop(Self);
-    Src->Drop(Self);
 }
 
 void mcc::StoreInstruction::Generate(
@@ -91,12 +81,25 @@ void mcc::StoreInstruction::Generate(
         commands.Append("$data modify {} {} {} set value {}", dst.ReferenceType, dst.Target, dst.Path, src.Name);
         break;
 
+    case ResultType_::Score:
+        commands.Append(
+                "{}execute store result {} {} {} {} 1 run scoreboard players get {} {}",
+                prefix,
+                dst.ReferenceType,
+                dst.Target,
+                dst.Path,
+                src.StoreType,
+                src.Player,
+                src.Objective);
+        break;
+
     default:
         Error(Where,
-              "src must be {}, {} or {}, but is {}",
+              "src must be {}, {}, {} or {}, but is {}",
               ResultType_::Value,
               ResultType_::Reference,
               ResultType_::Argument,
+              ResultType_::Score,
               src.Type);
     }
 }
@@ -4,9 +4,13 @@
 #include <mcc/error.hpp>
 #include <mcc/function.hpp>
 #include <mcc/instruction.hpp>
+#include <mcc/package.hpp>
 #include <mcc/type.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
 #include <ranges>
 #include <utility>
 
@@ -20,17 +24,9 @@ mcc::InstructionPtr mcc::SwitchInstruction::Create(
         const CaseTargetMap &case_targets)
 {
     auto self =
-            std::make_shared<SwitchInstruction>(where, name, context, parent, condition, default_target, case_targets);
+            MakeValue<SwitchInstruction>(where, name, context, parent, condition, default_target, case_targets);
 
     self->Self = self;
-    self->Condition->Use(self);
-    self->DefaultTarget->Use(self);
-    for (auto &[case_, target_] : self->CaseTargets)
-    {
-        case_->Use(self);
-        target_->Use(self);
-    }
-
     return self;
 }
 
@@ -48,20 +44,143 @@ mcc::SwitchInstruction::SwitchInstruction(
               context.GetVoid(),
               FieldType_::Value),
       Parent(std::move(parent)),
-      Condition(std::move(condition)),
-      DefaultTarget(std::move(default_target)),
-      CaseTargets(std::move(case_targets))
+      Condition(this, std::move(condition)),
+      DefaultTarget(this, std::move(default_target))
+{
+    CaseTargets.reserve(case_targets.size());
+    for (auto &[case_, target_] : case_targets)
+        CaseTargets.emplace_back(
+                std::piecewise_construct,
+                std::forward_as_tuple(this, case_),
+                std::forward_as_tuple(this, target_));
+}
+
+namespace
+{
+    enum class Dispatch_
+    {
+        Chain,
+        Table,
+        Search,
+    };
+
+    using IntegerCase = std::pair<mcc::IntegerT, mcc::BlockPtr>;
+}
+
+static constexpr size_t chain_max_cases = 4;
+static constexpr size_t table_min_cases = 8;
+
+static std::optional<std::vector<IntegerCase>> get_integer_cases(const mcc::SwitchInstruction &self)
+{
+    std::map<mcc::IntegerT, mcc::BlockPtr> cases;
+    for (auto &[case_, target_] : self.CaseTargets)
+    {
+        const auto number = std::dynamic_pointer_cast<mcc::ConstantNumber>(case_.Get());
+        if (!number || number->Value < std::numeric_limits<std::int32_t>::min()
+            || number->Value > std::numeric_limits<std::int32_t>::max())
+            return std::nullopt;
+
+        cases[number->Value] = target_;
+    }
+    return std::vector<IntegerCase>(cases.begin(), cases.end());
+}
+
+static std::map<std::string, mcc::BlockPtr> get_case_targets(const mcc::SwitchInstruction &self)
 {
+    std::map<std::string, mcc::BlockPtr> case_targets;
+    for (auto &[case_, target_] : self.CaseTargets)
+    {
+        auto case_value = case_->GenerateResult();
+        mcc::Assert(case_value.Type == mcc::ResultType_::Value,
+                    case_->Where,
+                    "case value must be {}, but is {}",
+                    mcc::ResultType_::Value,
+                    case_value.Type);
+        case_targets[case_value.Value] = target_;
+    }
+    return case_targets;
+}
+
+static Dispatch_ get_dispatch(const std::vector<IntegerCase> &cases)
+{
+    if (cases.size() <= chain_max_cases)
+        return Dispatch_::Chain;
+
+    const auto span = static_cast<size_t>(cases.back().first - cases.front().first) + 1;
+    if (cases.size() >= table_min_cases && span <= 2 * cases.size())
+        return Dispatch_::Table;
+
+    return Dispatch_::Search;
+}
+
+static mcc::ResourceLocation get_base(const mcc::SwitchInstruction &self)
+{
+    return self.Parent->Mangle().Child(std::format("__switch{}", self.GetStackId()));
+}
+
+static void generate_search_node(
+        const mcc::SwitchInstruction &self,
+        mcc::CommandVector &commands,
+        const std::vector<IntegerCase> &cases,
+        const size_t begin,
+        const size_t end,
+        const std::string &condition)
+{
+    std::string prefix, arguments;
+    self.Parent->ForwardArguments(prefix, arguments);
+
+    if (end - begin <= chain_max_cases)
+    {
+        for (auto i = begin; i < end; ++i)
+            commands.Append(
+                    "{}execute if score {} matches {} run return run function {}{}",
+                    prefix,
+                    condition,
+                    cases[i].first,
+                    cases[i].second->GetLocation(),
+                    arguments);
+        commands.Append("{}return run function {}{}", prefix, self.DefaultTarget->GetLocation(), arguments);
+        return;
+    }
+
+    const auto base   = get_base(self);
+    const auto middle = begin + (end - begin) / 2;
+
+    commands.Append(
+            "{}execute if score {} matches ..{} run return run function {}{}",
+            prefix,
+            condition,
+            cases[middle].first - 1,
+            base.Child(std::format("search_{}_{}", begin, middle)),
+            arguments);
+    commands.Append(
+            "{}return run function {}{}",
+            prefix,
+            base.Child(std::format("search_{}_{}", middle, end)),
+            arguments);
 }
 
-mcc::SwitchInstruction::~SwitchInstruction()
+static void generate_search_nodes(
+        const mcc::SwitchInstruction &self,
+        mcc::Package &package,
+        const std::vector<IntegerCase> &cases,
+        const size_t begin,
+        const size_t end,
+        const std::string &condition)
 {
-    Condition->Drop(Self);
-    DefaultTarget->Drop(Self);
-    for (auto &[case_, target_] : CaseTargets)
+    if (end - begin <= chain_max_cases)
+        return;
+
+    const auto base   = get_base(self);
+    const auto middle = begin + (end - begin) / 2;
+
+    for (auto [begin_, end_] : { std::pair(begin, middle), std::pair(middle, end) })
     {
-        case_->Drop(Self);
-        target_->Drop(Self);
+        const auto id = mcc::ResourceTable::Intern(base.Child(std::format("search_{}_{}", begin_, end_)));
+
+        mcc::CommandVector commands(package.Functions[id]);
+        generate_search_node(self, commands, cases, begin_, end_, condition);
+        generate_search_nodes(self, package, cases, begin_, end_, condition);
     }
 }
 
@@ -69,157 +188,171 @@ void mcc::SwitchInstruction::Generate(
         CommandVector &commands,
         bool stack) const
 {
-    auto location = Parent->Mangle();
+    const auto &location = Parent->Mangle();
 
     std::string prefix, arguments;
     Parent->ForwardArguments(prefix, arguments);
 
-    auto stack_path = GetStackPath();
-    auto tmp_name   = GetTemp();
-
     auto condition = Condition->GenerateResult();
 
-    std::string condition_prefix;
-    if (condition.WithArgument)
-        condition_prefix = "$";
-
-    std::map<std::string, BlockPtr> case_targets;
-    for (auto &[case_, target_] : CaseTargets)
+    if (condition.Type == ResultType_::Value)
     {
-        auto case_value = case_->GenerateResult();
-        Assert(case_value.Type == ResultType_::Value,
-               case_->Where,
-               "case value must be {}, but is {}",
-               ResultType_::Value,
-               case_value.Type);
-        case_targets[case_value.Value] = target_;
-    }
+        const auto case_targets = get_case_targets(*this);
 
-    switch (condition.Type)
-    {
-    case ResultType_::Value:
-    {
         BlockPtr block;
         if (auto it = case_targets.find(condition.Value); it != case_targets.end())
             block = it->second;
         else
             block = DefaultTarget;
         commands.Append("{}return run function {}{}", prefix, block->GetLocation(), arguments);
-        break;
+        return;
     }
 
+    auto score = std::format("%c {}", RegisterObjective);
+    switch (condition.Type)
+    {
     case ResultType_::Reference:
-        for (auto &[case_, target_] : case_targets)
-        {
-            commands.Append(CreateScore());
-            commands.Append(
-                    "{}execute store result score %c {} run data get {} {} {}",
-                    condition_prefix,
-                    tmp_name,
-                    condition.ReferenceType,
-                    condition.Target,
-                    condition.Path);
-            commands.Append("data remove storage {} {}", location, stack_path);
-            commands.Append(
-                    "execute if score %c {} matches {} run data modify storage {} {} set value 1",
-                    tmp_name,
-                    case_,
-                    location,
-                    stack_path);
-            commands.Append(RemoveScore());
-
-            commands.Append(
-                    "{}execute if data storage {} {} run return run function {}{}",
-                    prefix,
-                    location,
-                    stack_path,
-                    target_->GetLocation(),
-                    arguments);
-        }
-        commands.Append("{}return run function {}{}", prefix, DefaultTarget->GetLocation(), arguments);
+        commands.Append(
+                "{}execute store result score %c {} run data get {} {} {}",
+                condition.WithArgument ? "$" : "",
+                RegisterObjective,
+                condition.ReferenceType,
+                condition.Target,
+                condition.Path);
         break;
 
     case ResultType_::Argument:
-        for (auto &[case_, target_] : case_targets)
-        {
-            commands.Append(CreateScore());
-            commands.Append("$scoreboard players set %c {} {}", tmp_name, condition.Name);
-            commands.Append("data remove storage {} {}", location, stack_path);
-            commands.Append(
-                    "execute if score %c {} matches {} run data modify storage {} {} set value 1",
-                    tmp_name,
-                    case_,
-                    location,
-                    stack_path);
-            commands.Append(RemoveScore());
+        commands.Append("$scoreboard players set %c {} {}", RegisterObjective, condition.Name);
+        break;
 
-            commands.Append(
-                    "{}execute if data storage {} {} run return run function {}{}",
-                    prefix,
-                    location,
-                    stack_path,
-                    target_->GetLocation(),
-                    arguments);
-        }
-        commands.Append("{}return run function {}{}", prefix, DefaultTarget->GetLocation(), arguments);
+    case ResultType_::Score:
+        score = std::format("{} {}", condition.Player, condition.Objective);
         break;
 
     default:
         Error(Where,
-              "condition must be {}, {} or {}, but is {}",
+              "condition must be {}, {}, {} or {}, but is {}",
               ResultType_::Value,
               ResultType_::Reference,
               ResultType_::Argument,
+              ResultType_::Score,
               condition.Type);
     }
-}
 
-bool mcc::SwitchInstruction::RequireStack() const
-{
-    return Condition->RequireStack() || DefaultTarget->RequireStack()
-           || std::ranges::any_of(
-                   CaseTargets,
-                   [](const CaseTarget &case_target) { return case_target.second->RequireStack(); });
-}
+    const auto cases = get_integer_cases(*this);
+    if (!cases)
+    {
+        // cases that are not 32-bit integers are passed to matches as written
+        for (auto &[case_, target_] : get_case_targets(*this))
+            commands.Append(
+                    "{}execute if score {} matches {} run return run function {}{}",
+                    prefix,
+                    score,
+                    case_,
+                    target_->GetLocation(),
+                    arguments);
+        commands.Append("{}return run function {}{}", prefix, DefaultTarget->GetLocation(), arguments);
+        return;
+    }
 
-bool mcc::SwitchInstruction::IsTerminator() const
-{
-    return true;
+    switch (get_dispatch(*cases))
+    {
+    case Dispatch_::Chain:
+        generate_search_node(*this, commands, *cases, 0, cases->size(), score);
+        break;
+
+    case Dispatch_::Search:
+        // registers do not outlive the block
+        if (condition.Type == ResultType_::Score)
+        {
+            commands.Append("scoreboard players operation %c {0} = {1}", RegisterObjective, score);
+            score = std::format("%c {}", RegisterObjective);
+        }
+        generate_search_node(*this, commands, *cases, 0, cases->size(), score);
+        break;
+
+    case Dispatch_::Table:
+    {
+        const auto temp = GetTemp();
+        const auto base = get_base(*this);
+
+        commands.Append(
+                "{}execute unless score {} matches {}..{} run return run function {}{}",
+                prefix,
+                score,
+                cases->front().first,
+                cases->back().first,
+                DefaultTarget->GetLocation(),
+                arguments);
+        if (arguments.empty())
+            commands.Append("data modify storage {} {} set value {{}}", location, temp);
+        else
+            commands.Append("{}data modify storage {} {} set value{}", prefix, location, temp, arguments);
+        commands.Append(
+                "execute store result storage {} {}.__case int 1 run scoreboard players get {}",
+                location,
+                temp,
+                score);
+        commands.Append("return run function {} with storage {} {}", base.Child("table"), location, temp);
+        break;
+    }
+    }
 }
 
-void mcc::SwitchInstruction::Replace(
-        const ValuePtr value,
-        const ValuePtr replacement)
+void mcc::SwitchInstruction::GenerateDispatch(Package &package) const
 {
-    Assert(!!value, "value must not be null");
-    Assert(!!replacement, "replacement must not be null");
+    if (Condition->GenerateResult().Type == ResultType_::Value)
+        return;
 
-    if (value == Condition)
-    {
-        Condition->Drop(Self);
-        Condition = replacement;
-        Condition->Use(Self);
+    const auto cases = get_integer_cases(*this);
+    if (!cases)
         return;
-    }
 
-    if (value == DefaultTarget)
+    const auto base = get_base(*this);
+
+    std::string prefix, arguments;
+    Parent->ForwardArguments(prefix, arguments);
+
+    switch (get_dispatch(*cases))
     {
-        DefaultTarget->Drop(Self);
-        DefaultTarget = std::dynamic_pointer_cast<Block>(replacement);
-        DefaultTarget->Use(Self);
-        return;
-    }
+    case Dispatch_::Chain:
+        break;
 
-    for (auto &target : CaseTargets | std::views::values)
+    case Dispatch_::Search:
+        generate_search_nodes(*this, package, *cases, 0, cases->size(), std::format("%c {}", RegisterObjective));
+        break;
+
+    case Dispatch_::Table:
     {
-        if (value == target)
+        // the macro arguments are already bound
+        CommandVector table(package.Functions[ResourceTable::Intern(base.Child("table"))]);
+        table.Append("data remove storage {} {}", Parent->Mangle(), GetTemp());
+        table.Append("$return run function {}/case_$(__case){}", base, arguments);
+
+        auto it = cases->begin();
+        for (auto value = cases->front().first; value <= cases->back().first; ++value)
         {
-            target->Drop(Self);
-            target = std::dynamic_pointer_cast<Block>(replacement);
-            target->Use(Self);
-            return;
+            auto target = DefaultTarget.Get();
+            if (it != cases->end() && it->first == value)
+                target = (it++)->second;
+
+            CommandVector commands(package.Functions[ResourceTable::Intern(base.Child(std::format("case_{}", value)))]);
+            commands.Append("{}return run function {}{}", prefix, target->GetLocation(), arguments);
         }
+        break;
     }
+    }
+}
 
-    Error("value is not owned by this instruction");
+bool mcc::SwitchInstruction::RequireStack() const
+{
+    return Condition->RequireStack() || DefaultTarget->RequireStack()
+           || std::ranges::any_of(
+                   CaseTargets,
+                   [](const auto &case_target) { return case_target.second->RequireStack(); });
+}
+
+bool mcc::SwitchInstruction::IsTerminator() const
+{
+    return true;
 }
@@ -13,13 +13,8 @@ mcc::InstructionPtr mcc::ThrowInstruction::Create(
         const ValuePtr &value,
         const BlockPtr &landing_pad)
 {
-    auto self = std::make_shared<ThrowInstruction>(where, name, context, parent, value, landing_pad);
-
+    auto self  = MakeValue<ThrowInstruction>(where, name, context, parent, value, landing_pad);
     self->Self = self;
-    self->Value->Use(self);
-    if (self->LandingPad)
-        self->LandingPad->Use(self);
-
     return self;
 }
 
@@ -36,16 +31,9 @@ mcc::ThrowInstruction::ThrowInstruction(
               context.GetVoid(),
               FieldType_::Value),
       Parent(std::move(parent)),
-      Value(std::move(value)),
-      LandingPad(std::move(landing_pad))
-{
-}
-
-mcc::ThrowInstruction::~ThrowInstruction()
+      Value(this, std::move(value)),
+      LandingPad(this, std::move(landing_pad))
 {
-    Value->Drop(Self);
-    if (LandingPad)
-        LandingPad->Drop(Self);
 }
 
 void mcc::ThrowInstruction::Generate(
@@ -13,11 +13,8 @@ mcc::ValuePtr mcc::MemberReference::Create(
 
     auto type = object_type->Elements.at(member);
 
-    auto self = std::make_shared<MemberReference>(where, name, type, object, member);
-
+    auto self  = MakeValue<MemberReference>(where, name, type, object, member);
     self->Self = self;
-    self->Object->Use(self);
-
     return self;
 }
 
@@ -31,16 +28,11 @@ mcc::MemberReference::MemberReference(
             name,
             type,
             object->FieldType),
-      Object(object),
+      Object(this, object),
       Member(std::move(member))
 {
 }
 
-mcc::MemberReference::~MemberReference()
-{
-    Object->Drop(Self);
-}
-
 bool mcc::MemberReference::RequireStack() const
 {
     return Object->RequireStack();
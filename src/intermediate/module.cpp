@@ -1,3 +1,4 @@
+#include <mcc/block.hpp>
 #include <mcc/error.hpp>
 #include <mcc/function.hpp>
 #include <mcc/module.hpp>
@@ -29,6 +30,25 @@ mcc::Module::Module(Context &context)
 {
 }
 
+mcc::Module::~Module()
+{
+    // values refer to each other in cycles
+    for (auto &function : m_Functions)
+    {
+        for (auto &blocks : { &function->Blocks, &function->ErasedBlocks })
+            for (auto &block : *blocks)
+            {
+                while (!block->Instructions.empty())
+                    block->Instructions.pop_back();
+                block->Predecessors.clear();
+                block->Successors.clear();
+            }
+
+        function->Blocks.clear();
+        function->ErasedBlocks.clear();
+    }
+}
+
 mcc::Context &mcc::Module::GetContext() const
 {
     return m_Context;
@@ -51,12 +71,14 @@ mcc::FunctionPtr mcc::Module::CreateFunction(
         const TypePtr &result,
         const bool throws)
 {
-    for (auto &function : m_Functions)
+    for (auto &function : GetOverloads(location))
         if (CheckFunction(function, location, parameters))
             Error(where, "function {} is already defined with parameters {}", location, parameters);
 
     auto function = Function::Create(where, *this, location, parameters, result, throws);
     m_Functions.push_back(function);
+    m_Locations[location].push_back(function);
+    m_Paths[location.Path].push_back(function);
     return function;
 }
 
@@ -64,20 +86,35 @@ mcc::FunctionPtr mcc::Module::GetFunction(
         const ResourceLocation &location,
         const ParameterList &parameters) const
 {
-    for (auto &function : m_Functions)
+    for (auto &function : GetOverloads(location))
         if (CheckFunction(function, location, parameters))
             return function;
     return {};
 }
 
+const std::vector<mcc::FunctionPtr> &mcc::Module::GetOverloads(const ResourceLocation &location) const
+{
+    static const std::vector<FunctionPtr> empty;
+
+    if (const auto it = m_Locations.find(location); it != m_Locations.end())
+        return it->second;
+    return empty;
+}
+
+const std::vector<mcc::FunctionPtr> &mcc::Module::GetOverloads(const std::vector<std::string> &path) const
+{
+    static const std::vector<FunctionPtr> empty;
+
+    if (const auto it = m_Paths.find(path); it != m_Paths.end())
+        return it->second;
+    return empty;
+}
+
 mcc::ResourceLocation mcc::Module::Mangle(const FunctionPtr &function) const
 {
     auto count = 0u;
-    for (auto &fn : m_Functions)
+    for (auto &fn : GetOverloads(function->Location))
     {
-        if (fn->Location != function->Location)
-            continue;
-
         if (fn != function)
         {
             ++count;
@@ -11,13 +11,8 @@ mcc::ValuePtr mcc::GenericBlockReference::Create(
         const ValuePtr &position_z,
         const ValuePtr &path)
 {
-    auto self = std::make_shared<GenericBlockReference>(where, name, type, position_x, position_y, position_z, path);
-
+    auto self  = MakeValue<GenericBlockReference>(where, name, type, position_x, position_y, position_z, path);
     self->Self = self;
-    self->PositionX->Use(self);
-    self->PositionY->Use(self);
-    self->PositionZ->Use(self);
-
     return self;
 }
 
@@ -33,18 +28,11 @@ mcc::GenericBlockReference::GenericBlockReference(
             name,
             type,
             FieldType_::ImmutableReference),
-      PositionX(std::move(position_x)),
-      PositionY(std::move(position_y)),
-      PositionZ(std::move(position_z)),
-      Path(std::move(path))
-{
-}
-
-mcc::GenericBlockReference::~GenericBlockReference()
+      PositionX(this, std::move(position_x)),
+      PositionY(this, std::move(position_y)),
+      PositionZ(this, std::move(position_z)),
+      Path(this, std::move(path))
 {
-    PositionX->Drop(Self);
-    PositionY->Drop(Self);
-    PositionZ->Drop(Self);
 }
 
 bool mcc::GenericBlockReference::RequireStack() const
@@ -9,11 +9,8 @@ mcc::ValuePtr mcc::GenericEntityReference::Create(
         const ValuePtr &name_val,
         const ValuePtr &path)
 {
-    auto self = std::make_shared<GenericEntityReference>(where, name, type, name_val, path);
-
+    auto self  = MakeValue<GenericEntityReference>(where, name, type, name_val, path);
     self->Self = self;
-    self->NameVal->Use(self);
-
     return self;
 }
 
@@ -27,14 +24,9 @@ mcc::GenericEntityReference::GenericEntityReference(
             name,
             type,
             FieldType_::MutableReference),
-      NameVal(std::move(name_val)),
-      Path(std::move(path))
-{
-}
-
-mcc::GenericEntityReference::~GenericEntityReference()
+      NameVal(this, std::move(name_val)),
+      Path(this, std::move(path))
 {
-    NameVal->Drop(Self);
 }
 
 bool mcc::GenericEntityReference::RequireStack() const
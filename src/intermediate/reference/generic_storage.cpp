@@ -11,12 +11,8 @@ mcc::ValuePtr mcc::GenericStorageReference::Create(
         const ValuePtr &path,
         bool is_mutable)
 {
-    auto self = std::make_shared<GenericStorageReference>(where, name, type, location, path, is_mutable);
-
+    auto self  = MakeValue<GenericStorageReference>(where, name, type, location, path, is_mutable);
     self->Self = self;
-    self->Location->Use(self);
-    self->Path->Use(self);
-
     return self;
 }
 
@@ -45,15 +41,9 @@ mcc::GenericStorageReference::GenericStorageReference(
             name,
             type,
             is_mutable ? FieldType_::MutableReference : FieldType_::ImmutableReference),
-      Location(std::move(location)),
-      Path(std::move(path))
-{
-}
-
-mcc::GenericStorageReference::~GenericStorageReference()
+      Location(this, std::move(location)),
+      Path(this, std::move(path))
 {
-    Location->Drop(Self);
-    Path->Drop(Self);
 }
 
 bool mcc::GenericStorageReference::RequireStack() const
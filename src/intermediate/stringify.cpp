@@ -7,11 +7,8 @@ mcc::ValuePtr mcc::StringifyValue::Create(
         const std::string &name,
         const ValuePtr &target)
 {
-    auto self = std::make_shared<StringifyValue>(where, name, target);
-
+    auto self  = MakeValue<StringifyValue>(where, name, target);
     self->Self = self;
-    self->Target->Use(self);
-
     return self;
 }
 
@@ -23,13 +20,8 @@ mcc::StringifyValue::StringifyValue(
             name,
             target->Type->Types.GetString(),
             FieldType_::Value),
-      Target(target)
-{
-}
-
-mcc::StringifyValue::~StringifyValue()
+      Target(this, target)
 {
-    Target->Drop(Self);
 }
 
 bool mcc::StringifyValue::RequireStack() const
@@ -1,31 +1,105 @@
 #include <mcc/error.hpp>
 #include <mcc/value.hpp>
 
-auto mcc::operator<=>(
-        const WeakValuePtr &lhs,
-        const WeakValuePtr &rhs)
+static thread_local mcc::StackIdSpace default_space;
+static thread_local mcc::StackIdSpace *current_space = &default_space;
+
+mcc::StackIdScope::StackIdScope(StackIdSpace &space)
+    : m_Previous(current_space)
+{
+    current_space = &space;
+}
+
+mcc::StackIdScope::~StackIdScope()
+{
+    current_space = m_Previous;
+}
+
+uint32_t mcc::StackIdScope::Next()
+{
+    return current_space->Count++;
+}
+
+const mcc::StackIdSpace &mcc::StackIdScope::Current()
 {
-    if (lhs.expired() && rhs.expired())
-        return std::strong_ordering::equivalent;
-    if (lhs.expired())
-        return std::strong_ordering::less;
-    if (rhs.expired())
-        return std::strong_ordering::greater;
-    return lhs.lock() <=> rhs.lock();
+    return *current_space;
 }
 
-static uintptr_t global_stack = 0;
+mcc::Use::Use(ValueBase *user)
+    : m_User(user)
+{
+}
+
+mcc::Use::Use(Use &&other) noexcept
+    : m_User(other.m_User),
+      m_Value(other.m_Value),
+      m_Prev(other.m_Prev),
+      m_Next(other.m_Next)
+{
+    if (m_Prev)
+        m_Prev->m_Next = this;
+    else if (m_Value)
+        m_Value->m_FirstUse = this;
+    if (m_Next)
+        m_Next->m_Prev = this;
+
+    other.m_Value = nullptr;
+    other.m_Prev  = nullptr;
+    other.m_Next  = nullptr;
+}
+
+mcc::ValueBase *mcc::Use::GetUser() const
+{
+    return m_User;
+}
+
+mcc::Use *mcc::Use::GetNext() const
+{
+    return m_Next;
+}
+
+void mcc::Use::Link(ValueBase *value)
+{
+    if (!value)
+        return;
+
+    m_Value = value;
+    m_Prev  = nullptr;
+    m_Next  = value->m_FirstUse;
+    if (m_Next)
+        m_Next->m_Prev = this;
+    value->m_FirstUse = this;
+}
+
+void mcc::Use::Unlink()
+{
+    if (!m_Value)
+        return;
+
+    if (m_Prev)
+        m_Prev->m_Next = m_Next;
+    else
+        m_Value->m_FirstUse = m_Next;
+    if (m_Next)
+        m_Next->m_Prev = m_Prev;
+
+    m_Value = nullptr;
+    m_Prev  = nullptr;
+    m_Next  = nullptr;
+}
 
 mcc::ValueBase::ValueBase(
         SourceLocation where,
         std::string name,
         TypePtr type,
-        const FieldType_ field_type)
+        const FieldType_ field_type,
+        const bool has_stack_id)
     : Where(std::move(where)),
       Name(std::move(name)),
       Type(std::move(type)),
       FieldType(field_type),
-      StackId(global_stack++)
+      StackId(has_stack_id ? StackIdScope::Next() : 0),
+      m_StackIds(has_stack_id ? &StackIdScope::Current() : nullptr)
 {
 }
 
@@ -51,24 +125,31 @@ mcc::Result mcc::ValueBase::GenerateResultUnwrap() const
     return GenerateResult();
 }
 
-void mcc::ValueBase::Replace(
-        ValuePtr value,
-        ValuePtr replacement)
+bool mcc::ValueBase::HasUses() const
 {
-    Error(Where, "mcc::ValueBase::Replace");
+    return !!m_FirstUse;
 }
 
-void mcc::ValueBase::Use(WeakValuePtr user)
+mcc::Use *mcc::ValueBase::GetFirstUse() const
 {
-    Uses.insert(user);
+    return m_FirstUse;
 }
 
-void mcc::ValueBase::Drop(WeakValuePtr user)
+void mcc::ValueBase::ReplaceAllUsesWith(const ValuePtr &replacement)
 {
-    Uses.erase(user);
+    Assert(!!replacement, Where, "replacement must not be null");
+    Assert(replacement.get() != this, Where, "value must not replace itself");
+
+    while (m_FirstUse)
+        m_FirstUse->Set(replacement);
 }
 
 bool mcc::ValueBase::IsMutable() const
 {
     return FieldType == FieldType_::MutableReference;
 }
+
+uint32_t mcc::ValueBase::GetStackId() const
+{
+    return m_StackIds ? m_StackIds->Offset + StackId : StackId;
+}
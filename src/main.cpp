@@ -1,51 +1,33 @@
 #include <mcc/actions.hpp>
-#include <mcc/builder.hpp>
+#include <mcc/compiler.hpp>
 #include <mcc/error.hpp>
 #include <mcc/package.hpp>
-#include <mcc/parse.hpp>
-#include <mcc/statement.hpp>
-#include <mcc/type.hpp>
+#include <mcc/trace.hpp>
+#include <mcc/watch.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
 
-static void parse_file(
-        mcc::Package &package,
-        const std::filesystem::path &path)
-{
-    std::ifstream stream(path);
-    mcc::Assert(stream.is_open(), "failed to open file {}", path.string());
-
-    mcc::Context context;
-    mcc::Parser parser(context, stream, path.string());
-    mcc::Builder builder(context, package);
-
-    while (parser)
-        if (const auto node = parser())
-            node->Generate(builder);
-
-    builder.Generate();
-}
-
-static void parse_directory(
-        mcc::Package &package,
+static void collect_directory(
+        std::vector<std::filesystem::path> &paths,
         const std::filesystem::path &path)
 {
     for (auto &entry : std::filesystem::directory_iterator(path))
     {
         if (entry.is_directory())
         {
-            parse_directory(package, entry.path());
+            collect_directory(paths, entry.path());
             continue;
         }
 
         if (entry.path().extension() != ".mcc")
             continue;
 
-        parse_file(package, entry.path());
+        paths.push_back(entry.path());
     }
 }
 
@@ -67,19 +49,37 @@ int main(
                  { { false, "-name", "package name (default: 'example')" },
                     { false, "-description", "package description (default: 'the example package')" },
                     { false, "-version", "package version (default: '71')" } } },
-                // mcc compile [-pkg <package file>] [-target <target directory>]
-                //  -> compile a package to a target directory
+                // mcc compile [-pkg <package file>] [-target <target directory>] [-j <jobs>] [-whole] [-trace <trace file>] [-cache <cache directory>]
+                //  -> compile a package to a target directory, reusing the output of unchanged files from the cache directory if given
                 { 2,
                  "compile", "compile a package into the target directory",
                  { { false, "-pkg", "package file (default: 'info.json')" },
-                    { false, "-target", "target directory (default: 'target')" } } },
-                // mcc package [-pkg <package file>] [-target <target directory>] [-destination <destination file name>]
-                //  -> package a package into a zip destination file
+                    { false, "-target", "target directory (default: 'target')" },
+                    { false, "-j", "number of source files compiled in parallel (default: '1')" },
+                    { true, "-whole", "compile all source files into a single module" },
+                    { false, "-trace", "write a chrome trace of the compilation phases to this file" },
+                    { false, "-cache", "build cache directory, no cache is used if omitted" } } },
+                // mcc package [-pkg <package file>] [-target <target directory>] [-destination <destination file name>] [-j <jobs>] [-whole] [-store] [-trace <trace file>] [-cache <cache directory>]
+                //  -> compile a package straight into a zip destination file, without writing the target directory
                 { 3,
                  "package", "compress a package into a zip file, into the target directory",
                  { { false, "-pkg", "package file (default: 'info.json')" },
                     { false, "-target", "taget directory (default: 'target')" },
-                    { false, "-destination", "destination file name (default: '<package name>.zip')" } } }
+                    { false, "-destination", "destination file name (default: '<package name>.zip')" },
+                    { false, "-j", "number of source files compiled and entries compressed in parallel (default: '1')" },
+                    { true, "-whole", "compile all source files into a single module" },
+                    { true, "-store", "store entries without compressing them" },
+                    { false, "-trace", "write a chrome trace of the compilation phases to this file" },
+                    { false, "-cache", "build cache directory, no cache is used if omitted" } } },
+                // mcc watch [-pkg <package file>] [-target <target directory>] [-j <jobs>] [-whole] [-cache <cache directory>]
+                //  -> compile a package, then recompile whatever changes in the source directory until interrupted
+                { 4,
+                 "watch", "compile a package and keep recompiling it as its sources change",
+                 { { false, "-pkg", "package file (default: 'info.json')" },
+                    { false, "-target", "target directory (default: 'target')" },
+                    { false, "-j", "number of source files compiled in parallel (default: '1')" },
+                    { true, "-whole", "compile all source files into a single module" },
+                    { false, "-cache", "build cache directory, no cache is used if omitted" } } },
     });
     actions(argc, argv);
 
@@ -112,32 +112,162 @@ int main(
     {
         std::string pkg    = "info.json";
         std::string target = "target";
+        std::string jobs   = "1";
+        std::string trace;
+        std::string cache;
 
         (void) actions.String(0, pkg);
         (void) actions.String(1, target);
+        (void) actions.String(2, jobs);
+        (void) actions.String(5, cache);
+
+        if (actions.String(4, trace))
+            mcc::Trace::Enable();
 
         auto info = mcc::PackageInfo::Deserialize(pkg);
         mcc::Package package(info);
 
         mcc::Assert(std::filesystem::exists("src"), "source directory does not exist");
 
-        parse_directory(package, "src");
+        std::vector<std::filesystem::path> paths;
+        collect_directory(paths, "src");
+        std::ranges::sort(paths);
+
+        {
+            mcc::TraceSpan span("Compiler::Compile");
+            span.Arg("files", paths.size());
 
-        package.Write(target);
+            mcc::Compiler compiler(info, std::stoul(jobs), cache);
+            if (actions.Flag(3))
+                compiler.CompileWhole(package, paths);
+            else
+                (void) compiler.Compile(package, paths);
+        }
+
+        package.Write(target, std::stoul(jobs));
+
+        if (!trace.empty())
+            mcc::Trace::Write(trace);
 
         break;
     }
 
     case 3: // package
     {
-        // TODO: read 'info.json'
-        // TODO: compile files in 'src'
-        // TODO: write output to 'target'
-        // TODO: compress 'target' into 'package.zip'
+        std::string pkg    = "info.json";
+        std::string target = "target";
+        std::string destination;
+        std::string jobs = "1";
+        std::string trace;
+        std::string cache;
+
+        (void) actions.String(0, pkg);
+        (void) actions.String(1, target);
+        (void) actions.String(2, destination);
+        (void) actions.String(3, jobs);
+        (void) actions.String(7, cache);
+
+        if (actions.String(6, trace))
+            mcc::Trace::Enable();
+
+        auto info = mcc::PackageInfo::Deserialize(pkg);
+        mcc::Package package(info);
+
+        if (destination.empty())
+            destination = info.Name + ".zip";
+
+        mcc::Assert(std::filesystem::exists("src"), "source directory does not exist");
+
+        std::vector<std::filesystem::path> paths;
+        collect_directory(paths, "src");
+        std::ranges::sort(paths);
+
+        {
+            mcc::TraceSpan span("Compiler::Compile");
+            span.Arg("files", paths.size());
+
+            mcc::Compiler compiler(info, std::stoul(jobs), cache);
+            if (actions.Flag(4))
+                compiler.CompileWhole(package, paths);
+            else
+                (void) compiler.Compile(package, paths);
+        }
+
+        package.Pack(
+                std::filesystem::path(target) / destination,
+                actions.Flag(5) ? mcc::ZipMethod_::Store : mcc::ZipMethod_::Deflate,
+                std::stoul(jobs));
+
+        if (!trace.empty())
+            mcc::Trace::Write(trace);
 
         break;
     }
 
+    case 4: // watch
+    {
+        std::string pkg    = "info.json";
+        std::string target = "target";
+        std::string jobs   = "1";
+        std::string cache;
+
+        (void) actions.String(0, pkg);
+        (void) actions.String(1, target);
+        (void) actions.String(2, jobs);
+        (void) actions.String(4, cache);
+
+        auto info = mcc::PackageInfo::Deserialize(pkg);
+
+        mcc::Assert(std::filesystem::exists("src"), "source directory does not exist");
+
+        const auto whole = actions.Flag(3);
+
+        mcc::Compiler compiler(info, std::stoul(jobs), cache);
+        mcc::Watcher watcher("src");
+
+        std::unique_ptr<mcc::Package> previous;
+        for (;;)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+
+            std::vector<std::filesystem::path> paths;
+            collect_directory(paths, "src");
+            std::ranges::sort(paths);
+
+            try
+            {
+                auto package = std::make_unique<mcc::Package>(info);
+
+                auto count = paths.size();
+                if (whole)
+                    compiler.CompileWhole(*package, paths);
+                else
+                    count = compiler.Compile(*package, paths);
+
+                if (previous)
+                    package->WriteChanges(target, *previous, std::stoul(jobs));
+                else
+                    package->Write(target, std::stoul(jobs));
+                previous = std::move(package);
+
+                const auto end = std::chrono::steady_clock::now();
+                std::cerr << std::format(
+                        "compiled {} of {} files in {} ms",
+                        count,
+                        paths.size(),
+                        std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count())
+                          << std::endl;
+            }
+            catch (const std::exception &)
+            {
+                std::cerr << "compilation failed, waiting for changes" << std::endl;
+            }
+
+            for (auto &path : watcher.Wait())
+                compiler.Invalidate(path);
+        }
+    }
+
     case 0: // help
         actions.Print();
         break;
@@ -1,68 +1,353 @@
 #include <mcc/error.hpp>
 #include <mcc/package.hpp>
+#include <mcc/trace.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <functional>
+#include <mutex>
+#include <ranges>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+    struct OutputFile
+    {
+        std::filesystem::path Path;
+        const std::string *Content;
+        std::function<std::string()> Render;
+    };
+}
 
 mcc::Package::Package(const PackageInfo &info)
     : Info(info)
 {
 }
 
-void mcc::Package::Write(const std::filesystem::path &path) const
+void mcc::Package::Merge(const Package &other)
 {
-    if (std::filesystem::exists(path))
-        std::filesystem::remove_all(path);
+    for (auto &[id_, function_] : other.Functions)
+        Functions[id_].Append(function_);
 
-    const auto data = path / "data";
-    create_directories(data);
+    for (auto &[id_, tag_] : other.Tags)
+    {
+        auto &dst   = Tags[id_];
+        dst.Replace = dst.Replace || tag_.Replace;
+        dst.Values.insert(dst.Values.end(), tag_.Values.begin(), tag_.Values.end());
+    }
+}
 
-    for (auto &[namespace_, functions_] : Functions)
-        for (auto &[path_, function_] : functions_)
-        {
-            const auto file = data / namespace_ / "function" / std::vector(path_.begin(), path_.end() - 1)
-                              / (path_.back() + ".mcfunction");
-            const auto directory = file.parent_path();
-            create_directories(directory);
+// every score the compiler writes is held by a fake player, '%<name> <objective>'
+static bool uses_objective(
+        const mcc::FunctionInfo &function,
+        const std::string_view objective)
+{
+    auto &data = function.Data();
+    for (auto pos = data.find(objective); pos != std::string::npos; pos = data.find(objective, pos + 1))
+    {
+        const auto end = pos + objective.size();
+        if (pos < 2 || data[pos - 1] != ' ' || (end < data.size() && data[end] != ' ' && data[end] != '\n'))
+            continue;
 
-            std::ofstream stream(file);
-            Assert(stream.is_open(), "failed to open file {}", file.string());
+        const auto player = data.find_last_of(" \n", pos - 2);
+        if (data[player == std::string::npos ? 0 : player + 1] == '%')
+            return true;
+    }
+    return false;
+}
 
-            for (auto &command : function_)
-                stream << command << std::endl;
+void mcc::Package::AddLoadFunction()
+{
+    if (std::ranges::none_of(
+                Functions | std::views::values,
+                [](const FunctionInfo &function) { return uses_objective(function, RegisterObjective); }))
+        return;
 
-            stream.close();
-        }
+    const auto id = ResourceTable::Intern({ Info.Name, { "__load" } });
 
-    for (auto &[namespace_, tags_] : Tags)
-        for (auto &[path_, tag_] : tags_)
-        {
-            const auto file = data / namespace_ / "tags" / "function" / std::vector(path_.begin(), path_.end() - 1)
-                              / (path_.back() + ".json");
-            const auto directory = file.parent_path();
-            create_directories(directory);
+    auto &function = Functions[id];
+    function       = {};
+    function.Append("scoreboard objectives add {} dummy", RegisterObjective);
 
-            std::ofstream stream(file);
-            Assert(stream.is_open(), "failed to open file {}", file.string());
+    auto &[replace_, values_] = Tags[ResourceTable::Intern({ "minecraft", { "load" } })];
+    if (std::ranges::none_of(values_, [id](const Tag &tag) { return tag.Location == id; }))
+        values_.insert(values_.begin(), { .Location = id });
+}
 
-            stream << std::setw(2) << json::Node(tag_);
+static std::filesystem::path function_file(
+        const std::filesystem::path &data,
+        const mcc::ResourceId id)
+{
+    using mcc::operator/;
+    auto &[namespace_, path_] = mcc::ResourceTable::Get(id);
+    return data / namespace_ / "function" / std::vector(path_.begin(), path_.end() - 1) / (path_.back() + ".mcfunction");
+}
 
-            stream.close();
-        }
+static std::filesystem::path tag_file(
+        const std::filesystem::path &data,
+        const mcc::ResourceId id)
+{
+    using mcc::operator/;
+    auto &[namespace_, path_] = mcc::ResourceTable::Get(id);
+    return data / namespace_ / "tags" / "function" / std::vector(path_.begin(), path_.end() - 1) / (path_.back() + ".json");
+}
+
+static std::string render_json(const json::Node &node)
+{
+    std::ostringstream stream;
+    stream << std::setw(2) << node;
+    return stream.str();
+}
 
-    const auto package = path / "pack.mcmeta";
-    std::ofstream stream(package);
-    Assert(stream.is_open(), "failed to open file {}", package.string());
+static bool write_file(
+        const std::filesystem::path &file,
+        const std::string_view content)
+{
+    if (std::error_code ec; std::filesystem::file_size(file, ec) == content.size() && !ec)
+    {
+        std::ifstream stream(file, std::ios::binary);
+        std::string existing(content.size(), '\0');
+        if (stream.read(existing.data(), static_cast<std::streamsize>(existing.size())) && existing == content)
+            return false;
+    }
 
-    json::Node node = json::Node::Map{
-        {
-         "pack", json::Node::Map{
-                { "description", Info.Description },
-                { "pack_format", Info.Version },
-            }, },
+    std::error_code ec;
+    create_directories(file.parent_path(), ec);
+
+    std::ofstream stream(file, std::ios::binary);
+    mcc::Assert(stream.is_open(), "failed to open file {}", file.string());
+
+    stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return true;
+}
+
+template<typename F>
+static void parallel_for(
+        const size_t size,
+        const unsigned jobs,
+        F &&task)
+{
+    std::atomic_size_t next = 0;
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto run = [&]
+    {
+        for (size_t i; (i = next++) < size;)
+            try
+            {
+                task(i);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+                next = size;
+            }
     };
-    stream << std::setw(2) << node;
 
-    stream.close();
+    const auto count = std::min<size_t>(std::max(jobs, 1u), size);
+    if (count <= 1)
+        run();
+    else
+    {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < count; ++i)
+            threads.emplace_back(run);
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+static void remove_stale(
+        const std::filesystem::path &path,
+        const std::unordered_set<std::string> &keep)
+{
+    std::vector<std::filesystem::path> stale;
+    std::vector<std::filesystem::path> directories;
+    for (auto &entry : std::filesystem::recursive_directory_iterator(path))
+    {
+        if (entry.is_directory())
+            directories.push_back(entry.path());
+        else if (!keep.contains(entry.path().string()))
+            stale.push_back(entry.path());
+    }
+
+    for (auto &file : stale)
+        std::filesystem::remove(file);
+
+    for (auto &directory : directories | std::views::reverse)
+        if (std::filesystem::is_empty(directory))
+            std::filesystem::remove(directory);
+}
+
+static std::vector<OutputFile> collect_files(
+        const mcc::Package &package,
+        const std::filesystem::path &root)
+{
+    const auto data = root / "data";
+
+    std::vector<OutputFile> files;
+    files.reserve(package.Functions.size() + package.Tags.size() + 1);
+
+    for (auto &[id_, function_] : package.Functions)
+        files.emplace_back(function_file(data, id_), &function_.Data());
+
+    for (auto &[id_, tag_] : package.Tags)
+        files.emplace_back(tag_file(data, id_), nullptr, [&tag_] { return render_json(json::Node(tag_)); });
+
+    files.emplace_back(
+            root / "pack.mcmeta",
+            nullptr,
+            [&info = package.Info]
+            {
+                return render_json(
+                        json::Node::Map{
+                            {
+                             "pack", json::Node::Map{
+                                    { "description", info.Description },
+                                    { "pack_format", info.Version },
+                                }, },
+                        });
+            });
+
+    return files;
+}
+
+void mcc::Package::Write(
+        const std::filesystem::path &path,
+        const unsigned jobs) const
+{
+    TraceSpan span("Package::Write");
+
+    if (std::filesystem::exists(path) && !std::filesystem::is_directory(path))
+        std::filesystem::remove(path);
+
+    const auto files = collect_files(*this, path);
+    span.Arg("files", files.size());
+    parallel_for(
+            files.size(),
+            jobs,
+            [&files](const size_t i)
+            {
+                if (auto &[path_, content_, render_] = files[i]; content_)
+                    (void) write_file(path_, *content_);
+                else
+                    (void) write_file(path_, render_());
+            });
+
+    std::unordered_set<std::string> keep;
+    keep.reserve(files.size());
+    for (auto &file : files)
+        keep.insert(file.Path.string());
+
+    remove_stale(path, keep);
+}
+
+void mcc::Package::Pack(
+        const std::filesystem::path &destination,
+        const ZipMethod_ method,
+        const unsigned jobs) const
+{
+    TraceSpan span("Package::Pack");
+
+    auto files = collect_files(*this, {});
+    span.Arg("files", files.size());
+
+    // resource ids depend on interning order, which varies between runs
+    std::ranges::sort(files, {}, &OutputFile::Path);
+
+    if (destination.has_parent_path())
+        create_directories(destination.parent_path());
+
+    ZipWriter writer(destination);
+
+    const size_t window = std::max(jobs, 1u) * 64;
+
+    std::vector<ZipEntry> entries;
+    for (size_t begin = 0; begin < files.size(); begin += window)
+    {
+        entries.resize(std::min(window, files.size() - begin));
+        parallel_for(
+                entries.size(),
+                jobs,
+                [&](const size_t i)
+                {
+                    if (auto &[path_, content_, render_] = files[begin + i]; content_)
+                        entries[i] = ZipEntry::Compress(path_.generic_string(), *content_, method);
+                    else
+                        entries[i] = ZipEntry::Compress(path_.generic_string(), render_(), method);
+                });
+
+        for (auto &entry : entries)
+            writer.Add(entry);
+    }
+
+    writer.Finish();
+}
+
+void mcc::Package::WriteChanges(
+        const std::filesystem::path &path,
+        const Package &previous,
+        const unsigned jobs) const
+{
+    TraceSpan span("Package::WriteChanges");
+
+    const auto files          = collect_files(*this, path);
+    const auto previous_files = collect_files(previous, path);
+
+    std::unordered_map<std::string, const std::string *> previous_contents;
+    previous_contents.reserve(previous_files.size());
+    for (auto &file : previous_files)
+        previous_contents.emplace(file.Path.string(), file.Content);
+
+    span.Arg("files", files.size());
+    parallel_for(
+            files.size(),
+            jobs,
+            [&files, &previous_contents](const size_t i)
+            {
+                auto &[path_, content_, render_] = files[i];
+                if (!content_)
+                {
+                    (void) write_file(path_, render_());
+                    return;
+                }
+
+                if (const auto it = previous_contents.find(path_.string());
+                    it != previous_contents.end() && it->second && *it->second == *content_)
+                    return;
+
+                (void) write_file(path_, *content_);
+            });
+
+    std::unordered_set<std::string> keep;
+    keep.reserve(files.size());
+    for (auto &file : files)
+        keep.insert(file.Path.string());
+
+    for (auto &file : previous_files)
+    {
+        if (keep.contains(file.Path.string()))
+            continue;
+
+        std::filesystem::remove(file.Path);
+
+        std::error_code ec;
+        auto parent = file.Path.parent_path();
+        while (parent != path && std::filesystem::is_empty(parent, ec) && !ec)
+        {
+            std::filesystem::remove(parent);
+            parent = parent.parent_path();
+        }
+    }
 }
 
 mcc::PackageInfo mcc::PackageInfo::Deserialize(const std::filesystem::path &path)
@@ -87,20 +372,13 @@ void mcc::PackageInfo::Serialize(const std::filesystem::path &path) const
     stream << std::setw(2) << json::Node(*this);
 }
 
-void data::serializer<mcc::ResourceLocation>::to_data(
-        json::Node &node,
-        const mcc::ResourceLocation &value)
-{
-    node = value.String();
-}
-
 void data::serializer<mcc::Tag>::to_data(
         json::Node &node,
         const mcc::Tag &value)
 {
     node = json::Node::Map{
-        {       "id", value.Location },
-        { "required", value.Required },
+        {       "id", mcc::ResourceTable::GetString(value.Location) },
+        { "required",                                 value.Required },
     };
 }
 
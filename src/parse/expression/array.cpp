@@ -19,5 +19,5 @@ mcc::ExpressionPtr mcc::Parser::ParseArrayExpression()
     if (SkipIf(TokenType::Other, ":"))
         type = ParseType();
 
-    return std::make_unique<ArrayExpression>(where, std::move(elements), type);
+    return MakeNode<ArrayExpression>(where, std::move(elements), type);
 }
@@ -5,7 +5,7 @@ mcc::ExpressionPtr mcc::Parser::ParseBinaryExpression(
         ExpressionPtr left,
         const unsigned min_pre)
 {
-    static const std::map<std::string, unsigned> pres{
+    static const std::map<std::string_view, unsigned> pres{
         {  "=", 0 },
         { "+=", 0 },
         { "-=", 0 },
@@ -41,7 +41,7 @@ mcc::ExpressionPtr mcc::Parser::ParseBinaryExpression(
         auto right     = ParseOperandExpression();
         while (At(TokenType::Operator) && has_pre() && (get_pre() > pre || (!get_pre() && !pre)))
             right = ParseBinaryExpression(std::move(right), pre + (get_pre() > pre ? 1 : 0));
-        left = std::make_unique<BinaryExpression>(operator_.Where, operator_.Value, std::move(left), std::move(right));
+        left = MakeNode<BinaryExpression>(operator_.Where, std::string(operator_.Value), std::move(left), std::move(right));
     }
 
     if (const auto binary = dynamic_cast<BinaryExpression *>(left.get()))
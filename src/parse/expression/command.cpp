@@ -7,7 +7,7 @@ mcc::ExpressionPtr mcc::Parser::ParseCommandExpression()
     TypePtr type;
     if (SkipIf(TokenType::Other, ":"))
         type = ParseType();
-    auto command = Expect(TokenType::FormatString).Value;
+    CommandT command(Expect(TokenType::FormatString).Value);
 
-    return std::make_unique<CommandExpression>(where, type, command);
+    return MakeNode<CommandExpression>(where, type, command);
 }
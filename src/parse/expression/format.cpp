@@ -14,16 +14,16 @@ mcc::ExpressionPtr mcc::Parser::ParseFormatExpression()
     auto get_where = [&]() -> SourceLocation
     {
         return {
-            where.Filename,
-            where.Col + offset,
+            where.File,
             where.Row,
+            where.Col + offset,
         };
     };
 
-    for (size_t pos; (pos = format.find("${")) != std::string::npos;)
+    for (size_t pos; (pos = format.find("${")) != std::string_view::npos;)
     {
         if (pos != 0)
-            nodes.push_back(std::make_unique<StringNode>(get_where(), format.substr(0, pos)));
+            nodes.push_back(MakeNode<StringNode>(get_where(), std::string(format.substr(0, pos))));
 
         format = format.substr(pos + 2);
 
@@ -33,12 +33,11 @@ mcc::ExpressionPtr mcc::Parser::ParseFormatExpression()
         offset += 2;
         auto stream_where = get_where();
 
-        std::stringstream stream(format);
-        Parser parser(m_Context, stream, stream_where);
+        Parser parser(m_Context, format, stream_where);
 
         auto expression = parser.ParseExpression();
 
-        nodes.push_back(std::make_unique<ExpressionNode>(node_where, std::move(expression)));
+        nodes.push_back(MakeNode<ExpressionNode>(node_where, std::move(expression)));
 
         auto count = parser.Count();
         format     = format.substr(count);
@@ -46,7 +45,7 @@ mcc::ExpressionPtr mcc::Parser::ParseFormatExpression()
     }
 
     if (!format.empty())
-        nodes.push_back(std::make_unique<StringNode>(get_where(), format));
+        nodes.push_back(MakeNode<StringNode>(get_where(), std::string(format)));
 
-    return std::make_unique<FormatExpression>(where, std::move(nodes));
+    return MakeNode<FormatExpression>(where, std::move(nodes));
 }
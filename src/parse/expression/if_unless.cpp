@@ -3,14 +3,14 @@
 
 mcc::ExpressionPtr mcc::Parser::ParseIfUnlessExpression()
 {
-    auto token = ExpectEnum("if", "unless");
+    auto token = ExpectEnum(Keyword::If, Keyword::Unless);
     Expect(TokenType::Other, "(");
     auto condition = ParseExpression();
     Expect(TokenType::Other, ")");
     auto then = ParseExpression();
-    Expect(TokenType::Symbol, "else");
+    Expect(Keyword::Else);
     auto else_ = ParseExpression();
-    return std::make_unique<IfUnlessExpression>(
+    return MakeNode<IfUnlessExpression>(
             token.Where,
             token.Value == "unless",
             std::move(condition),
@@ -4,6 +4,6 @@
 mcc::ExpressionPtr mcc::Parser::ParseMacroExpression()
 {
     auto where = Expect(TokenType::Other, "!").Where;
-    auto name  = Expect(TokenType::Symbol).Value;
-    return std::make_unique<MacroExpression>(where, name);
+    std::string name(Expect(TokenType::Symbol).Value);
+    return MakeNode<MacroExpression>(where, name);
 }
@@ -5,8 +5,8 @@
 mcc::ExpressionPtr mcc::Parser::ParseNumberExpression()
 {
     auto token = Expect(TokenType::Number);
-    return std::make_unique<ConstantExpression>(
+    return MakeNode<ConstantExpression>(
             token.Where,
             ConstantNumber::Create(token.Where, m_Context, static_cast<IntegerT>(token.Number)),
-            token.Value);
+            std::string(token.Value));
 }
@@ -11,17 +11,19 @@ mcc::ExpressionPtr mcc::Parser::ParseObjectExpression()
     {
         auto key = At(TokenType::String) ? Skip() : Expect(TokenType::Symbol);
 
+        std::string name(key.Value);
+
         ExpressionPtr value;
         if (SkipIf(TokenType::Other, ":"))
             value = ParseExpression();
         else
-            value = std::make_unique<SymbolExpression>(key.Where, key.Value);
+            value = MakeNode<SymbolExpression>(key.Where, name);
 
-        elements[key.Value] = std::move(value);
+        elements[name] = std::move(value);
 
         if (!At(TokenType::Other, "}"))
             Expect(TokenType::Other, ",");
     }
 
-    return std::make_unique<ObjectExpression>(where, std::move(elements));
+    return MakeNode<ObjectExpression>(where, std::move(elements));
 }
@@ -21,7 +21,7 @@ mcc::ExpressionPtr mcc::Parser::ParseOperandExpression()
             }
             Expect(TokenType::Other, ")");
 
-            operand = std::make_unique<CallExpression>(where, std::move(operand), std::move(arguments));
+            operand = MakeNode<CallExpression>(where, std::move(operand), std::move(arguments));
             continue;
         }
 
@@ -30,15 +30,15 @@ mcc::ExpressionPtr mcc::Parser::ParseOperandExpression()
             auto index = ParseExpression();
             Expect(TokenType::Other, "]");
 
-            operand = std::make_unique<SubscriptExpression>(where, std::move(operand), std::move(index));
+            operand = MakeNode<SubscriptExpression>(where, std::move(operand), std::move(index));
             continue;
         }
 
         if (SkipIf(TokenType::Other, "."))
         {
-            auto member = Expect(TokenType::Symbol).Value;
+            std::string member(Expect(TokenType::Symbol).Value);
 
-            operand = std::make_unique<MemberExpression>(where, std::move(operand), member);
+            operand = MakeNode<MemberExpression>(where, std::move(operand), member);
             continue;
         }
 
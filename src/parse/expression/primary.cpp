@@ -4,11 +4,11 @@
 
 mcc::ExpressionPtr mcc::Parser::ParsePrimaryExpression()
 {
-    if (AtEnum("if", "unless"))
+    if (AtEnum(Keyword::If, Keyword::Unless))
         return ParseIfUnlessExpression();
-    if (At(TokenType::Symbol, "switch"))
+    if (At(Keyword::Switch))
         return ParseSwitchExpression();
-    if (At(TokenType::Symbol, "ref"))
+    if (At(Keyword::Ref))
         return ParseRefExpression();
     if (At(TokenType::Number))
         return ParseNumberExpression();
@@ -38,7 +38,7 @@ mcc::ExpressionPtr mcc::Parser::ParsePrimaryExpression()
     {
         auto token   = Skip();
         auto operand = ParseOperandExpression();
-        return std::make_unique<UnaryExpression>(token.Where, token.Value, std::move(operand));
+        return MakeNode<UnaryExpression>(token.Where, std::string(token.Value), std::move(operand));
     }
 
     Error(m_Token.Where, "cannot parse {} '{}'", m_Token.Type, m_Token.Value);
@@ -3,14 +3,14 @@
 
 mcc::ExpressionPtr mcc::Parser::ParseRefExpression()
 {
-    auto where = Expect(TokenType::Symbol, "ref").Where;
+    auto where = Expect(Keyword::Ref).Where;
 
     Expect(TokenType::Operator, "<");
     auto type = ParseType();
     Expect(TokenType::Operator, ">");
 
     Expect(TokenType::Other, "(");
-    auto target_type = *ToReferenceType(ExpectEnum("block", "entity", "storage").Value);
+    auto target_type = *ToReferenceType(ExpectEnum(Keyword::Block, Keyword::Entity, Keyword::Storage).Value);
     Expect(TokenType::Other, ",");
 
     ExpressionPtr target_position_x, target_position_y, target_position_z, target_name, target_location;
@@ -36,7 +36,7 @@ mcc::ExpressionPtr mcc::Parser::ParseRefExpression()
     auto path = ParseExpression();
     Expect(TokenType::Other, ")");
 
-    return std::make_unique<RefExpression>(
+    return MakeNode<RefExpression>(
             where,
             type,
             target_type,
@@ -6,8 +6,9 @@
 mcc::ExpressionPtr mcc::Parser::ParseStringExpression()
 {
     auto token = Expect(TokenType::String);
-    return std::make_unique<ConstantExpression>(
+    std::string value(token.Value);
+    return MakeNode<ConstantExpression>(
             token.Where,
-            ConstantString::Create(token.Where, m_Context, token.Value),
-            '"' + token.Value + '"');
+            ConstantString::Create(token.Where, m_Context, value),
+            '"' + value + '"');
 }
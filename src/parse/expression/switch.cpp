@@ -4,7 +4,7 @@
 
 mcc::ExpressionPtr mcc::Parser::ParseSwitchExpression()
 {
-    auto where = Expect(TokenType::Symbol, "switch").Where;
+    auto where = Expect(Keyword::Switch).Where;
     Expect(TokenType::Other, "(");
     auto condition = ParseExpression();
     Expect(TokenType::Other, ")");
@@ -13,14 +13,14 @@ mcc::ExpressionPtr mcc::Parser::ParseSwitchExpression()
     std::vector<std::pair<std::vector<ExpressionPtr>, ExpressionPtr>> cases;
     while (!At(TokenType::Other, "}") && !At(TokenType::EoF))
     {
-        if (SkipIf(TokenType::Symbol, "default"))
+        if (SkipIf(Keyword::Default))
         {
             Expect(TokenType::Operator, "->");
             default_ = ParseExpression();
             continue;
         }
 
-        Expect(TokenType::Symbol, "case");
+        Expect(Keyword::Case);
         std::vector<ExpressionPtr> conditions;
         do
             conditions.push_back(ParseExpression());
@@ -33,5 +33,5 @@ mcc::ExpressionPtr mcc::Parser::ParseSwitchExpression()
 
     Assert(!!default_, where, "switch expression must specify exactly one default case");
 
-    return std::make_unique<SwitchExpression>(where, std::move(condition), std::move(default_), std::move(cases));
+    return MakeNode<SwitchExpression>(where, std::move(condition), std::move(default_), std::move(cases));
 }
@@ -4,13 +4,14 @@
 mcc::ExpressionPtr mcc::Parser::ParseSymbolExpression()
 {
     auto token = Expect(TokenType::Symbol);
+    std::string name(token.Value);
     if (!SkipIf(TokenType::Other, ":"))
-        return std::make_unique<SymbolExpression>(token.Where, token.Value);
+        return MakeNode<SymbolExpression>(token.Where, name);
 
     std::vector<std::string> path;
     do
-        path.push_back(Expect(TokenType::Symbol).Value);
+        path.emplace_back(Expect(TokenType::Symbol).Value);
     while (SkipIf(TokenType::Operator, "/"));
 
-    return std::make_unique<ResourceExpression>(token.Where, ResourceLocation(token.Value, path));
+    return MakeNode<ResourceExpression>(token.Where, ResourceLocation(name, path));
 }
@@ -1,20 +1,127 @@
 #include <mcc/parse.hpp>
+#include <mcc/type.hpp>
 
-#include <set>
+#include <array>
+#include <charconv>
+#include <cstdint>
 
-mcc::Token &mcc::Parser::Next()
+namespace
 {
-    static const std::map<std::string, std::set<int>> operator_map{
-        { "=",      { '=', '>' } },
-        { "<",           { '=' } },
-        { ">",           { '=' } },
-        { "+",      { '=', '+' } },
-        { "-", { '=', '-', '>' } },
-        { "*",           { '=' } },
-        { "/",           { '=' } },
-        { "%",           { '=' } },
+    enum class CharClass : unsigned char
+    {
+        Undefined,
+        Space,
+        Digit,
+        Alpha,
+        Other,
+        Operator,
+        String,
+        FormatString,
+    };
+
+    constexpr auto char_classes = []
+    {
+        std::array<CharClass, 256> table{};
+
+        auto assign = [&table](const std::string_view chars, const CharClass value)
+        {
+            for (const auto c : chars)
+                table[static_cast<unsigned char>(c)] = value;
+        };
+
+        assign(" \t\n\v\f\r", CharClass::Space);
+        assign("0123456789", CharClass::Digit);
+        assign("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_", CharClass::Alpha);
+        assign("(){}[]:,;~^#$?!@.&|", CharClass::Other);
+        assign("=<>+-*/%", CharClass::Operator);
+        assign("\"", CharClass::String);
+        assign("`", CharClass::FormatString);
+
+        return table;
+    }();
+
+    constexpr CharClass ClassOf(const int c)
+    {
+        return char_classes[static_cast<unsigned char>(c)];
+    }
+
+    constexpr bool IsSymbolChar(const int c)
+    {
+        const auto value = ClassOf(c);
+        return value == CharClass::Alpha || value == CharClass::Digit;
+    }
+
+    template<size_t N, size_t M>
+    class PerfectHash
+    {
+    public:
+        constexpr explicit PerfectHash(const std::array<std::string_view, N> &keys)
+            : m_Keys(keys)
+        {
+            while (!Build())
+                ++m_Seed;
+        }
+
+        [[nodiscard]] constexpr int Find(const std::string_view key) const
+        {
+            const auto slot = m_Slots[Hash(key, m_Seed) % M];
+            return slot && m_Keys[slot - 1] == key ? slot - 1 : -1;
+        }
+
+    private:
+        static constexpr std::uint32_t Hash(const std::string_view key, const std::uint32_t seed)
+        {
+            std::uint32_t hash = 2166136261u ^ seed;
+            for (const auto c : key)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 16777619u;
+            }
+            return hash ^ hash >> 16;
+        }
+
+        constexpr bool Build()
+        {
+            m_Slots = {};
+            for (size_t i = 0; i < N; ++i)
+            {
+                auto &slot = m_Slots[Hash(m_Keys[i], m_Seed) % M];
+                if (slot)
+                    return false;
+                slot = static_cast<int>(i + 1);
+            }
+            return true;
+        }
+
+        std::array<std::string_view, N> m_Keys;
+        std::array<int, M> m_Slots{};
+        std::uint32_t m_Seed = 0;
     };
 
+    constexpr PerfectHash<std::size(mcc::KeywordNames), 128> keyword_table(std::to_array(mcc::KeywordNames));
+
+    constexpr PerfectHash<20, 64> operator_table(
+            std::to_array<std::string_view>(
+                {
+                    "=", "==", "=>",
+                    "<", "<=",
+                    ">", ">=",
+                    "+", "+=", "++",
+                    "-", "-=", "--", "->",
+                    "*", "*=",
+                    "/", "/=",
+                    "%", "%=",
+                }));
+
+    static_assert(keyword_table.Find("namespace") == static_cast<int>(mcc::Keyword::Namespace));
+    static_assert(keyword_table.Find("foo") < 0);
+    static_assert(operator_table.Find("->") >= 0 && operator_table.Find("=<") < 0);
+}
+
+mcc::Token &mcc::Parser::Next()
+{
+    ++m_Tokens;
+
     enum class LexState
     {
         None,
@@ -28,8 +135,18 @@ mcc::Token &mcc::Parser::Next()
     auto state = LexState::None;
     auto where = m_Where;
 
-    std::string raw;
-    std::string value;
+    auto offset = [this]
+    {
+        return m_Count - 1;
+    };
+
+    auto view = [this](const size_t begin, const size_t end)
+    {
+        return m_Source.substr(begin, end - begin);
+    };
+
+    const auto raw_begin = offset();
+    auto value_begin     = raw_begin;
 
     auto formatted = false;
 
@@ -38,187 +155,153 @@ mcc::Token &mcc::Parser::Next()
         switch (state)
         {
         case LexState::None:
-            switch (m_Buf)
+            switch (ClassOf(m_Buf))
             {
-            case '(':
-            case ')':
-            case '{':
-            case '}':
-            case '[':
-            case ']':
-            case ':':
-            case ',':
-            case ';':
-            case '~':
-            case '^':
-            case '#':
-            case '$':
-            case '?':
-            case '!':
-            case '@':
-            case '.':
-            case '&':
-            case '|':
-                where = m_Where;
-                raw += static_cast<char>(m_Buf);
-                value += static_cast<char>(m_Buf);
+            case CharClass::Space:
+                Get();
+                break;
+
+            case CharClass::Digit:
+                where       = m_Where;
+                value_begin = offset();
+                state       = LexState::Number;
+                break;
+
+            case CharClass::Alpha:
+                where       = m_Where;
+                value_begin = offset();
+                state       = LexState::Symbol;
+                break;
+
+            case CharClass::Other:
+                where       = m_Where;
+                value_begin = offset();
                 Get();
                 return m_Token = {
                     .Type  = TokenType::Other,
                     .Where = std::move(where),
-                    .Raw   = std::move(raw),
-                    .Value = std::move(value),
+                    .Raw   = view(raw_begin, offset()),
+                    .Value = view(value_begin, offset()),
                 };
 
-            case '=':
-            case '<':
-            case '>':
-            case '+':
-            case '-':
-            case '*':
-            case '/':
-            case '%':
-                where = m_Where;
-                raw += static_cast<char>(m_Buf);
-                value += static_cast<char>(m_Buf);
-                state = LexState::Operator;
+            case CharClass::Operator:
+                where       = m_Where;
+                value_begin = offset();
+                state       = LexState::Operator;
                 Get();
                 break;
 
-            case '`':
+            case CharClass::FormatString:
                 formatted = true;
-            case '"':
-                raw += static_cast<char>(m_Buf);
+            case CharClass::String:
                 where = m_Where;
                 state = LexState::String;
                 Get();
+                value_begin = offset();
                 break;
 
-            default:
-                if (std::isspace(m_Buf))
-                {
-                    raw += static_cast<char>(m_Buf);
-                    Get();
-                    break;
-                }
-
-                if (std::isdigit(m_Buf))
-                {
-                    where = m_Where;
-                    state = LexState::Number;
-                    break;
-                }
-
-                if (std::isalpha(m_Buf) || m_Buf == '_')
-                {
-                    where = m_Where;
-                    state = LexState::Symbol;
-                    break;
-                }
-
-                where = m_Where;
-                raw += static_cast<char>(m_Buf);
-                value += static_cast<char>(m_Buf);
+            case CharClass::Undefined:
+                where       = m_Where;
+                value_begin = offset();
                 Get();
                 return m_Token = {
                     .Type  = TokenType::Undefined,
                     .Where = std::move(where),
-                    .Raw   = std::move(raw),
-                    .Value = std::move(value),
+                    .Raw   = view(raw_begin, offset()),
+                    .Value = view(value_begin, offset()),
                 };
             }
             break;
 
         case LexState::Symbol:
-            if (!std::isalnum(m_Buf) && m_Buf != '_')
+            if (!IsSymbolChar(m_Buf))
+            {
+                const auto value   = view(value_begin, offset());
+                const auto keyword = keyword_table.Find(value);
                 return m_Token = {
-                    .Type  = TokenType::Symbol,
-                    .Where = std::move(where),
-                    .Raw   = std::move(raw),
-                    .Value = std::move(value),
+                    .Type   = TokenType::Symbol,
+                    .Where  = std::move(where),
+                    .Raw    = view(raw_begin, offset()),
+                    .Value  = value,
+                    .Symbol = keyword >= 0 ? static_cast<SymbolT>(keyword) : m_Context.GetSymbols().Intern(value),
                 };
+            }
 
-            raw += static_cast<char>(m_Buf);
-            value += static_cast<char>(m_Buf);
             Get();
             break;
 
         case LexState::Number:
-            if (!std::isdigit(m_Buf))
+            if (ClassOf(m_Buf) != CharClass::Digit)
             {
+                const auto value = view(value_begin, offset());
+
+                IndexT number = 0;
+                std::from_chars(value.data(), value.data() + value.size(), number);
+
                 return m_Token = {
                     .Type   = TokenType::Number,
                     .Where  = std::move(where),
-                    .Raw    = std::move(raw),
+                    .Raw    = view(raw_begin, offset()),
                     .Value  = value,
-                    .Number = std::stoull(value),
+                    .Number = number,
                 };
             }
 
-            raw += static_cast<char>(m_Buf);
-            value += static_cast<char>(m_Buf);
             Get();
             break;
 
         case LexState::String:
             if (m_Buf == (formatted ? '`' : '"'))
             {
-                raw += static_cast<char>(m_Buf);
+                const auto value = view(value_begin, offset());
                 Get();
                 return m_Token = {
                     .Type  = formatted ? TokenType::FormatString : TokenType::String,
                     .Where = std::move(where),
-                    .Raw   = std::move(raw),
-                    .Value = std::move(value),
+                    .Raw   = view(raw_begin, offset()),
+                    .Value = value,
                 };
             }
 
-            raw += static_cast<char>(m_Buf);
-            value += static_cast<char>(m_Buf);
             Get();
             break;
 
         case LexState::Operator:
+        {
+            const auto value = view(value_begin, offset());
+
             if (value == "/" && m_Buf == '*')
             {
-                raw += static_cast<char>(m_Buf);
                 state = LexState::Comment;
                 Get();
                 break;
             }
 
-            if (!operator_map.contains(value) || !operator_map.at(value).contains(m_Buf))
+            if (operator_table.Find(view(value_begin, offset() + 1)) < 0)
                 return m_Token = {
                     .Type  = TokenType::Operator,
                     .Where = std::move(where),
-                    .Raw   = std::move(raw),
-                    .Value = std::move(value),
+                    .Raw   = view(raw_begin, offset()),
+                    .Value = value,
                 };
 
-            raw += static_cast<char>(m_Buf);
-            value += static_cast<char>(m_Buf);
             Get();
             break;
+        }
 
         case LexState::Comment:
             if (m_Buf == '*')
             {
-                raw += static_cast<char>(m_Buf);
                 Get();
                 if (m_Buf == '/')
                 {
-                    raw += static_cast<char>(m_Buf);
-                    value.clear();
                     state = LexState::None;
                     Get();
                     break;
                 }
             }
             else
-            {
-                raw += static_cast<char>(m_Buf);
                 Get();
-            }
             break;
         }
     }
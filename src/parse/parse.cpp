@@ -6,12 +6,12 @@
 
 mcc::Parser::Parser(
         Context &context,
-        std::istream &stream,
+        const std::string_view source,
         const std::string &filename)
     : Parser(context,
-             stream,
+             source,
              SourceLocation(
-                     filename,
+                     FileTable::Intern(filename),
                      1,
                      0))
 {
@@ -19,10 +19,10 @@ mcc::Parser::Parser(
 
 mcc::Parser::Parser(
         Context &context,
-        std::istream &stream,
+        const std::string_view source,
         SourceLocation location)
     : m_Context(context),
-      m_Stream(stream),
+      m_Source(source),
       m_Where(std::move(location))
 {
     Get();
@@ -34,9 +34,19 @@ size_t mcc::Parser::Count() const
     return m_Count - m_Token.Raw.size();
 }
 
+size_t mcc::Parser::Tokens() const
+{
+    return m_Tokens;
+}
+
+const std::map<std::string, mcc::TypePtr> &mcc::Parser::GetNamedLookups() const
+{
+    return m_NamedLookups;
+}
+
 mcc::Parser::operator bool() const
 {
-    return !m_Stream.eof();
+    return m_Count <= m_Source.size();
 }
 
 mcc::TreeNodePtr mcc::Parser::operator()()
@@ -46,7 +56,7 @@ mcc::TreeNodePtr mcc::Parser::operator()()
 
 void mcc::Parser::Get()
 {
-    m_Buf = m_Stream.get();
+    m_Buf = m_Count < m_Source.size() ? static_cast<unsigned char>(m_Source[m_Count]) : -1;
     m_Count++;
     if (m_Buf == '\n')
     {
@@ -59,7 +69,7 @@ void mcc::Parser::Get()
 
 bool mcc::Parser::At(
         const TokenType type,
-        const std::string &value) const
+        const std::string_view value) const
 {
     if (m_Token.Type != type)
         return false;
@@ -70,24 +80,35 @@ bool mcc::Parser::At(
     return true;
 }
 
-bool mcc::Parser::AtAny(const std::vector<TokenType> &types) const
+bool mcc::Parser::At(const Keyword keyword) const
+{
+    return m_Token.Type == TokenType::Symbol && m_Token.Symbol == static_cast<SymbolT>(keyword);
+}
+
+bool mcc::Parser::AtAny(const std::initializer_list<TokenType> types) const
 {
     return std::ranges::any_of(types, [this](auto &type) { return At(type); });
 }
 
-bool mcc::Parser::AtEnum(const std::vector<const char *> &values) const
+bool mcc::Parser::AtEnum(const std::initializer_list<Keyword> keywords) const
 {
-    return std::ranges::any_of(values, [this](auto &value) { return At(TokenType::Symbol, value); });
+    return std::ranges::any_of(keywords, [this](auto &keyword) { return At(keyword); });
 }
 
 bool mcc::Parser::SkipIf(
         const TokenType type,
-        const std::string &value)
+        const std::string_view value)
 {
-    if (m_Token.Type != type)
+    if (!At(type, value))
         return false;
 
-    if (!value.empty() && m_Token.Value != value)
+    Next();
+    return true;
+}
+
+bool mcc::Parser::SkipIf(const Keyword keyword)
+{
+    if (!At(keyword))
         return false;
 
     Next();
@@ -104,7 +125,7 @@ mcc::Token mcc::Parser::Skip()
 
 mcc::Token mcc::Parser::Expect(
         TokenType type,
-        std::string value)
+        const std::string_view value)
 {
     Assert(m_Token.Type == type, m_Token.Where, "expected {}, but is {}", type, m_Token.Type);
 
@@ -113,20 +134,27 @@ mcc::Token mcc::Parser::Expect(
     return Skip();
 }
 
-mcc::Token mcc::Parser::ExpectAny(const std::vector<TokenType> &types)
+mcc::Token mcc::Parser::Expect(const Keyword keyword)
+{
+    Assert(At(keyword), m_Token.Where, "expected '{}', but is '{}'", keyword, m_Token.Value);
+
+    return Skip();
+}
+
+mcc::Token mcc::Parser::ExpectAny(const std::initializer_list<TokenType> types)
 {
     for (auto &type : types)
         if (At(type))
             return Skip();
 
-    Error(m_Token.Where, "expected {}, but is {}", types, m_Token.Type);
+    Error(m_Token.Where, "expected {}, but is {}", std::vector(types), m_Token.Type);
 }
 
-mcc::Token mcc::Parser::ExpectEnum(const std::vector<const char *> &values)
+mcc::Token mcc::Parser::ExpectEnum(const std::initializer_list<Keyword> keywords)
 {
-    for (auto &value : values)
-        if (At(TokenType::Symbol, value))
+    for (auto &keyword : keywords)
+        if (At(keyword))
             return Skip();
 
-    Error(m_Token.Where, "expected {}, but is '{}'", values, m_Token.Value);
+    Error(m_Token.Where, "expected {}, but is '{}'", std::vector(keywords), m_Token.Value);
 }
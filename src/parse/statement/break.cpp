@@ -3,6 +3,6 @@
 
 mcc::StatementPtr mcc::Parser::ParseBreakStatement()
 {
-    auto where = Expect(TokenType::Symbol, "break").Where;
-    return std::make_unique<BreakStatement>(where);
+    auto where = Expect(Keyword::Break).Where;
+    return MakeNode<BreakStatement>(where);
 }
@@ -3,6 +3,6 @@
 
 mcc::StatementPtr mcc::Parser::ParseContinueStatement()
 {
-    auto where = Expect(TokenType::Symbol, "continue").Where;
-    return std::make_unique<ContinueStatement>(where);
+    auto where = Expect(Keyword::Continue).Where;
+    return MakeNode<ContinueStatement>(where);
 }
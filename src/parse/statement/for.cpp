@@ -7,7 +7,7 @@ mcc::StatementPtr mcc::Parser::ParseForStatement()
     StatementPtr prefix, suffix;
     ExpressionPtr condition;
 
-    auto where = Expect(TokenType::Symbol, "for").Where;
+    auto where = Expect(Keyword::For).Where;
     Expect(TokenType::Other, "(");
     if (!SkipIf(TokenType::Other, ","))
     {
@@ -25,7 +25,7 @@ mcc::StatementPtr mcc::Parser::ParseForStatement()
         Expect(TokenType::Other, ")");
     }
     auto do_ = ParseStatement();
-    return std::make_unique<ForStatement>(
+    return MakeNode<ForStatement>(
             where,
             std::move(prefix),
             std::move(condition),
@@ -4,13 +4,13 @@
 
 mcc::StatementPtr mcc::Parser::ParseForEachStatement()
 {
-    auto where = Expect(TokenType::Symbol, "foreach").Where;
+    auto where = Expect(Keyword::ForEach).Where;
     Expect(TokenType::Other, "(");
-    auto constant = SkipIf(TokenType::Symbol, "const") || (Expect(TokenType::Symbol, "let"), false);
-    auto name     = Expect(TokenType::Symbol).Value;
+    auto constant = SkipIf(Keyword::Const) || (Expect(Keyword::Let), false);
+    std::string name(Expect(TokenType::Symbol).Value);
     Expect(TokenType::Other, ":");
     auto iterable = ParseExpression();
     Expect(TokenType::Other, ")");
     auto do_ = ParseStatement();
-    return std::make_unique<ForEachStatement>(where, constant, name, std::move(iterable), std::move(do_));
+    return MakeNode<ForEachStatement>(where, constant, name, std::move(iterable), std::move(do_));
 }
@@ -4,7 +4,7 @@
 
 mcc::StatementPtr mcc::Parser::ParseIfUnlessStatement()
 {
-    auto token = ExpectEnum("if", "unless");
+    auto token = ExpectEnum(Keyword::If, Keyword::Unless);
     Expect(TokenType::Other, "(");
     auto condition = ParseExpression();
     Expect(TokenType::Other, ")");
@@ -12,10 +12,10 @@ mcc::StatementPtr mcc::Parser::ParseIfUnlessStatement()
     auto then = ParseStatement();
 
     StatementPtr else_;
-    if (SkipIf(TokenType::Symbol, "else"))
+    if (SkipIf(Keyword::Else))
         else_ = ParseStatement();
 
-    return std::make_unique<IfUnlessStatement>(
+    return MakeNode<IfUnlessStatement>(
             token.Where,
             token.Value == "unless",
             std::move(condition),
@@ -10,5 +10,5 @@ mcc::StatementPtr mcc::Parser::ParseMultiStatement()
         statements.push_back(ParseStatement());
     Expect(TokenType::Other, "}");
 
-    return std::make_unique<MultiStatement>(where, std::move(statements));
+    return MakeNode<MultiStatement>(where, std::move(statements));
 }
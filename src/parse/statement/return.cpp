@@ -4,7 +4,7 @@
 
 mcc::StatementPtr mcc::Parser::ParseReturnStatement()
 {
-    auto where = Expect(TokenType::Symbol, "return").Where;
-    auto value = SkipIf(TokenType::Symbol, "void") ? nullptr : ParseExpression();
-    return std::make_unique<ReturnStatement>(where, std::move(value));
+    auto where = Expect(Keyword::Return).Where;
+    auto value = SkipIf(Keyword::Void) ? nullptr : ParseExpression();
+    return MakeNode<ReturnStatement>(where, std::move(value));
 }
@@ -4,29 +4,29 @@
 
 mcc::StatementPtr mcc::Parser::ParseStatement()
 {
-    if (At(TokenType::Symbol, "break"))
+    if (At(Keyword::Break))
         return ParseBreakStatement();
-    if (At(TokenType::Symbol, "continue"))
+    if (At(Keyword::Continue))
         return ParseContinueStatement();
-    if (At(TokenType::Symbol, "delete"))
+    if (At(Keyword::Delete))
         return ParseDeleteStatement();
-    if (At(TokenType::Symbol, "for"))
+    if (At(Keyword::For))
         return ParseForStatement();
-    if (At(TokenType::Symbol, "foreach"))
+    if (At(Keyword::ForEach))
         return ParseForEachStatement();
-    if (AtEnum("if", "unless"))
+    if (AtEnum(Keyword::If, Keyword::Unless))
         return ParseIfUnlessStatement();
     if (At(TokenType::Other, "{"))
         return ParseMultiStatement();
-    if (At(TokenType::Symbol, "return"))
+    if (At(Keyword::Return))
         return ParseReturnStatement();
-    if (At(TokenType::Symbol, "switch"))
+    if (At(Keyword::Switch))
         return ParseSwitchStatement();
-    if (At(TokenType::Symbol, "throw"))
+    if (At(Keyword::Throw))
         return ParseThrowStatement();
-    if (At(TokenType::Symbol, "try"))
+    if (At(Keyword::Try))
         return ParseTryCatchStatement();
-    if (AtEnum("let", "const", "constexpr"))
+    if (AtEnum(Keyword::Let, Keyword::Const, Keyword::ConstExpr))
         return ParseVariableStatement();
     return ParseExpression();
 }
@@ -5,7 +5,7 @@
 
 mcc::StatementPtr mcc::Parser::ParseSwitchStatement()
 {
-    auto where = Expect(TokenType::Symbol, "switch").Where;
+    auto where = Expect(Keyword::Switch).Where;
     Expect(TokenType::Other, "(");
     auto condition = ParseExpression();
     Expect(TokenType::Other, ")");
@@ -14,7 +14,7 @@ mcc::StatementPtr mcc::Parser::ParseSwitchStatement()
     std::vector<std::pair<std::vector<ExpressionPtr>, StatementPtr>> cases;
     while (!At(TokenType::Other, "}") && !At(TokenType::EoF))
     {
-        if (SkipIf(TokenType::Symbol, "default"))
+        if (SkipIf(Keyword::Default))
         {
             Assert(!default_, where, "only one default case is permitted");
             if (SkipIf(TokenType::Operator, "->"))
@@ -24,7 +24,7 @@ mcc::StatementPtr mcc::Parser::ParseSwitchStatement()
             continue;
         }
 
-        Expect(TokenType::Symbol, "case");
+        Expect(Keyword::Case);
         std::vector<ExpressionPtr> conditions;
         do
             conditions.push_back(ParseExpression());
@@ -38,5 +38,5 @@ mcc::StatementPtr mcc::Parser::ParseSwitchStatement()
     }
     Expect(TokenType::Other, "}");
 
-    return std::make_unique<SwitchStatement>(where, std::move(condition), std::move(default_), std::move(cases));
+    return MakeNode<SwitchStatement>(where, std::move(condition), std::move(default_), std::move(cases));
 }
@@ -4,7 +4,7 @@
 
 mcc::StatementPtr mcc::Parser::ParseThrowStatement()
 {
-    auto where = Expect(TokenType::Symbol, "throw").Where;
-    auto value = SkipIf(TokenType::Symbol, "void") ? nullptr : ParseExpression();
-    return std::make_unique<ThrowStatement>(where, std::move(value));
+    auto where = Expect(Keyword::Throw).Where;
+    auto value = SkipIf(Keyword::Void) ? nullptr : ParseExpression();
+    return MakeNode<ThrowStatement>(where, std::move(value));
 }
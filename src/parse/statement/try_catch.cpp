@@ -3,14 +3,14 @@
 
 mcc::StatementPtr mcc::Parser::ParseTryCatchStatement()
 {
-    auto where = Expect(TokenType::Symbol, "try").Where;
+    auto where = Expect(Keyword::Try).Where;
 
     auto try_ = ParseStatement();
 
     StatementPtr catch_;
     std::string variable;
     TypePtr error_type;
-    if (SkipIf(TokenType::Symbol, "catch"))
+    if (SkipIf(Keyword::Catch))
     {
         if (SkipIf(TokenType::Other, "("))
         {
@@ -23,5 +23,5 @@ mcc::StatementPtr mcc::Parser::ParseTryCatchStatement()
         catch_ = ParseStatement();
     }
 
-    return std::make_unique<TryCatchStatement>(where, std::move(try_), std::move(catch_), variable, error_type);
+    return MakeNode<TryCatchStatement>(where, std::move(try_), std::move(catch_), variable, error_type);
 }
@@ -5,14 +5,14 @@
 
 mcc::StatementPtr mcc::Parser::ParseVariableStatement()
 {
-    auto token = ExpectEnum("let", "const", "constexpr");
+    auto token = ExpectEnum(Keyword::Let, Keyword::Const, Keyword::ConstExpr);
 
     auto declarator   = *ToDeclarator(token.Value);
     auto is_reference = declarator != Declarator_::ConstExpr && SkipIf(TokenType::Other, "&");
 
     std::vector<std::string> names;
     do
-        names.push_back(Expect(TokenType::Symbol).Value);
+        names.emplace_back(Expect(TokenType::Symbol).Value);
     while (SkipIf(TokenType::Other, ","));
 
     TypePtr type;
@@ -26,7 +26,7 @@ mcc::StatementPtr mcc::Parser::ParseVariableStatement()
 
     Assert(type || value, token.Where, "variable definition must at least specify either its type or initializer");
 
-    return std::make_unique<VariableStatement>(
+    return MakeNode<VariableStatement>(
             token.Where,
             declarator,
             is_reference,
@@ -0,0 +1,25 @@
+#include <mcc/error.hpp>
+#include <mcc/lex.hpp>
+
+mcc::SymbolTable::SymbolTable()
+{
+    for (auto keyword : KeywordNames)
+        (void) Intern(keyword);
+}
+
+mcc::SymbolT mcc::SymbolTable::Intern(const std::string_view name)
+{
+    if (const auto it = m_Symbols.find(name); it != m_Symbols.end())
+        return it->second;
+
+    const auto symbol = static_cast<SymbolT>(m_Names.size());
+    auto &stored      = m_Names.emplace_back(name);
+    m_Symbols.emplace(stored, symbol);
+    return symbol;
+}
+
+std::string_view mcc::SymbolTable::Get(const SymbolT symbol) const
+{
+    Assert(symbol < m_Names.size(), "undefined symbol {}", symbol);
+    return m_Names[symbol];
+}
@@ -7,13 +7,13 @@
 
 mcc::TreeNodePtr mcc::Parser::ParseDefineNode()
 {
-    auto where       = Expect(TokenType::Symbol, "define").Where;
-    auto is_operator = SkipIf(TokenType::Symbol, "operator");
+    auto where       = Expect(Keyword::Define).Where;
+    auto is_operator = SkipIf(Keyword::Operator);
 
     ResourceLocation location;
     if (is_operator)
     {
-        const auto operator_ = Expect(TokenType::Operator).Value;
+        const std::string operator_(Expect(TokenType::Operator).Value);
         location.Path        = { "operator", BinaryExpression::MapOperator(operator_) };
     }
     else
@@ -25,11 +25,11 @@ mcc::TreeNodePtr mcc::Parser::ParseDefineNode()
     Expect(TokenType::Other, "(");
     while (!At(TokenType::Other, ")") && !At(TokenType::EoF))
     {
-        const auto is_constant = SkipIf(TokenType::Symbol, "const");
+        const auto is_constant = SkipIf(Keyword::Const);
         const auto is_reference =
                 SkipIf(TokenType::Other, "&") || (is_constant && (Expect(TokenType::Other, "&"), true));
 
-        auto name = Expect(TokenType::Symbol).Value;
+        std::string name(Expect(TokenType::Symbol).Value);
 
         Expect(TokenType::Other, ":");
 
@@ -49,7 +49,7 @@ mcc::TreeNodePtr mcc::Parser::ParseDefineNode()
 
     auto result_type = SkipIf(TokenType::Other, ":") ? ParseType() : m_Context.GetVoid();
 
-    auto throws = SkipIf(TokenType::Symbol, "throws");
+    auto throws = SkipIf(Keyword::Throws);
 
     if (At(TokenType::Other, "#"))
         while (!At(TokenType::Other, "{") && !At(TokenType::EoF))
@@ -65,7 +65,7 @@ mcc::TreeNodePtr mcc::Parser::ParseDefineNode()
     if (At(TokenType::Other, "{"))
         body = ParseMultiStatement();
 
-    return std::make_unique<DefineNode>(
+    return MakeNode<DefineNode>(
             where,
             is_operator,
             location,
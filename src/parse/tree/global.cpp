@@ -3,10 +3,10 @@
 
 mcc::TreeNodePtr mcc::Parser::ParseGlobalNode()
 {
-    auto where    = Expect(TokenType::Symbol, "global").Where;
+    auto where    = Expect(Keyword::Global).Where;
     auto location = ParseResourceLocation(true);
     Expect(TokenType::Operator, "=>");
     auto type = ParseType();
 
-    return std::make_unique<GlobalNode>(where, location, type);
+    return MakeNode<GlobalNode>(where, location, type);
 }
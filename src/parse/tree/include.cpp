@@ -3,12 +3,12 @@
 
 mcc::TreeNodePtr mcc::Parser::ParseIncludeNode()
 {
-    const auto where    = Expect(TokenType::Symbol, "include").Where;
+    const auto where    = Expect(Keyword::Include).Where;
     const auto filename = Expect(TokenType::String).Value;
 
     std::filesystem::path filepath(filename);
     if (filepath.is_relative())
-        filepath = std::filesystem::path(where.Filename).parent_path() / filename;
+        filepath = std::filesystem::path(FileTable::GetFilename(where.File)).parent_path() / filename;
 
-    return std::make_unique<IncludeNode>(where, filepath);
+    return MakeNode<IncludeNode>(where, filepath);
 }
@@ -3,9 +3,9 @@
 
 mcc::TreeNodePtr mcc::Parser::ParseNamespaceNode()
 {
-    auto where = Expect(TokenType::Symbol, "namespace").Where;
+    auto where = Expect(Keyword::Namespace).Where;
 
-    auto namespace_ = Expect(TokenType::Symbol).Value;
+    std::string namespace_(Expect(TokenType::Symbol).Value);
 
-    return std::make_unique<NamespaceNode>(where, namespace_);
+    return MakeNode<NamespaceNode>(where, namespace_);
 }
@@ -7,15 +7,15 @@ mcc::TreeNodePtr mcc::Parser::ParseTreeNode()
     if (m_Token.Type == TokenType::EoF)
         return {};
 
-    if (At(TokenType::Symbol, "define"))
+    if (At(Keyword::Define))
         return ParseDefineNode();
-    if (At(TokenType::Symbol, "global"))
+    if (At(Keyword::Global))
         return ParseGlobalNode();
-    if (At(TokenType::Symbol, "include"))
+    if (At(Keyword::Include))
         return ParseIncludeNode();
-    if (At(TokenType::Symbol, "namespace"))
+    if (At(Keyword::Namespace))
         return ParseNamespaceNode();
-    if (At(TokenType::Symbol, "type"))
+    if (At(Keyword::Type))
         return ParseTypeNode();
 
     Error(m_Token.Where, "cannot parse {} '{}'", m_Token.Type, m_Token.Value);
@@ -13,23 +13,32 @@ mcc::TypePtr mcc::Parser::ParseBaseType()
 
     if (At(TokenType::Symbol))
     {
-        auto name = Skip().Value;
+        const auto token = Skip();
 
-        if (name == "void")
+        switch (static_cast<Keyword>(token.Symbol))
+        {
+        case Keyword::Void:
             return m_Context.GetVoid();
-        if (name == "number")
+        case Keyword::Number:
             return m_Context.GetNumber();
-        if (name == "string")
+        case Keyword::String:
             return m_Context.GetString();
-        if (name == "array")
+        case Keyword::Array:
             return m_Context.GetAnyArray();
-        if (name == "object")
+        case Keyword::Object:
             return m_Context.GetAnyObject();
-        if (name == "function")
+        case Keyword::Function:
             return m_Context.GetAnyFunction();
+        default:
+            break;
+        }
 
+        const std::string name(token.Value);
         if (auto type = m_Context.GetNamed(name))
+        {
+            m_NamedLookups.emplace(name, type);
             return type;
+        }
 
         Error(where, "undefined type {}", name);
     }
@@ -40,7 +49,7 @@ mcc::TypePtr mcc::Parser::ParseBaseType()
 
         while (!At(TokenType::Other, "}") && !At(TokenType::EoF))
         {
-            auto name = Expect(TokenType::Symbol).Value;
+            std::string name(Expect(TokenType::Symbol).Value);
             Expect(TokenType::Other, ":");
             elements[name] = ParseType();
 
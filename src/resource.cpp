@@ -0,0 +1,52 @@
+#include <mcc/error.hpp>
+#include <mcc/resource.hpp>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct ResourceEntry
+    {
+        mcc::ResourceLocation Location;
+        std::string String;
+    };
+}
+
+static std::shared_mutex table_mutex;
+static std::deque<ResourceEntry> table_entries;
+static std::unordered_map<mcc::ResourceLocation, mcc::ResourceId> table_ids;
+
+mcc::ResourceId mcc::ResourceTable::Intern(const ResourceLocation &location)
+{
+    {
+        std::shared_lock lock(table_mutex);
+        if (const auto it = table_ids.find(location); it != table_ids.end())
+            return it->second;
+    }
+
+    std::unique_lock lock(table_mutex);
+    if (const auto it = table_ids.find(location); it != table_ids.end())
+        return it->second;
+
+    const auto id = static_cast<ResourceId>(table_entries.size());
+    table_entries.emplace_back(location, location.String());
+    table_ids.emplace(location, id);
+    return id;
+}
+
+const mcc::ResourceLocation &mcc::ResourceTable::Get(const ResourceId id)
+{
+    std::shared_lock lock(table_mutex);
+    Assert(id < table_entries.size(), "undefined resource id {}", id);
+    return table_entries[id].Location;
+}
+
+const std::string &mcc::ResourceTable::GetString(const ResourceId id)
+{
+    std::shared_lock lock(table_mutex);
+    Assert(id < table_entries.size(), "undefined resource id {}", id);
+    return table_entries[id].String;
+}
@@ -13,6 +13,8 @@ bool mcc::Result::operator==(const Result &result) const
         return ReferenceType == result.ReferenceType && Target == result.Target && Path == result.Path;
     case ResultType_::Argument:
         return Name == result.Name;
+    case ResultType_::Score:
+        return Player == result.Player && Objective == result.Objective;
     default:
         return false;
     }
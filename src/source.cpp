@@ -0,0 +1,109 @@
+#include <mcc/error.hpp>
+#include <mcc/source.hpp>
+
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct FileEntry
+    {
+        std::string Filename;
+        std::string Canonical;
+    };
+}
+
+static std::shared_mutex file_mutex;
+// id 0 is the unnamed file
+static std::deque<FileEntry> file_entries(1);
+static std::unordered_map<std::string, mcc::FileId> file_ids{ { {}, 0 } };
+
+static std::string canonical_name(const std::string &filename)
+{
+    std::error_code error;
+    auto path = std::filesystem::weakly_canonical(filename, error);
+    if (error)
+        return filename;
+    return path.string();
+}
+
+mcc::FileId mcc::FileTable::Intern(const std::string &filename)
+{
+    {
+        std::shared_lock lock(file_mutex);
+        if (const auto it = file_ids.find(filename); it != file_ids.end())
+            return it->second;
+    }
+
+    auto canonical = canonical_name(filename);
+
+    std::unique_lock lock(file_mutex);
+    if (const auto it = file_ids.find(filename); it != file_ids.end())
+        return it->second;
+
+    const auto id = static_cast<FileId>(file_entries.size());
+    file_entries.emplace_back(filename, std::move(canonical));
+    file_ids.emplace(filename, id);
+    return id;
+}
+
+const std::string &mcc::FileTable::GetFilename(const FileId id)
+{
+    std::shared_lock lock(file_mutex);
+    Assert(id < file_entries.size(), "undefined file id {}", id);
+    return file_entries[id].Filename;
+}
+
+const std::string &mcc::FileTable::GetCanonical(const FileId id)
+{
+    std::shared_lock lock(file_mutex);
+    Assert(id < file_entries.size(), "undefined file id {}", id);
+    return file_entries[id].Canonical;
+}
+
+mcc::SourceBuffer::SourceBuffer(const std::filesystem::path &path)
+{
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream.is_open())
+        return;
+
+    const auto size = stream.tellg();
+    if (size < 0)
+        return;
+
+    m_Data.resize(static_cast<size_t>(size));
+    stream.seekg(0);
+    if (!stream.read(m_Data.data(), size))
+        return;
+
+    m_Open = true;
+}
+
+mcc::SourceBuffer::SourceBuffer(std::string data)
+    : m_Open(true),
+      m_Data(std::move(data))
+{
+}
+
+bool mcc::SourceBuffer::IsOpen() const
+{
+    return m_Open;
+}
+
+const char *mcc::SourceBuffer::Data() const
+{
+    return m_Data.data();
+}
+
+size_t mcc::SourceBuffer::Size() const
+{
+    return m_Data.size();
+}
+
+std::string_view mcc::SourceBuffer::View() const
+{
+    return m_Data;
+}
@@ -0,0 +1,165 @@
+#include <mcc/error.hpp>
+#include <mcc/trace.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    struct TraceEvent
+    {
+        std::string Name;
+        std::string Args;
+        double Begin;
+        double Duration;
+        unsigned Thread;
+    };
+}
+
+static std::atomic_bool trace_enabled;
+static std::chrono::steady_clock::time_point trace_begin;
+
+static std::mutex trace_mutex;
+static std::vector<TraceEvent> trace_events;
+
+static unsigned trace_thread()
+{
+    static std::atomic_uint next;
+    thread_local const auto thread = next++;
+    return thread;
+}
+
+static void escape(
+        std::string &destination,
+        const std::string_view value)
+{
+    for (const auto c : value)
+        switch (c)
+        {
+        case '"':
+            destination += "\\\"";
+            break;
+        case '\\':
+            destination += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                std::format_to(std::back_inserter(destination), "\\u{:04x}", static_cast<unsigned>(c));
+            else
+                destination += c;
+            break;
+        }
+}
+
+static double microseconds(const std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void mcc::Trace::Enable()
+{
+    trace_begin   = std::chrono::steady_clock::now();
+    trace_enabled = true;
+}
+
+bool mcc::Trace::IsEnabled()
+{
+    return trace_enabled;
+}
+
+void mcc::Trace::Write(const std::filesystem::path &path)
+{
+    std::ofstream stream(path);
+    Assert(stream.is_open(), "failed to open file {}", path.string());
+
+    std::lock_guard lock(trace_mutex);
+
+    std::string data = "{\"traceEvents\":[\n";
+    for (auto &[name_, args_, begin_, duration_, thread_] : trace_events)
+    {
+        if (data.back() != '\n')
+            data += ",\n";
+
+        data += "{\"name\":\"";
+        escape(data, name_);
+        std::format_to(
+                std::back_inserter(data),
+                "\",\"cat\":\"mcc\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{},\"args\":{{{}}}}}",
+                begin_,
+                duration_,
+                thread_,
+                args_);
+    }
+    data += "\n]}\n";
+
+    stream << data;
+}
+
+mcc::TraceSpan::TraceSpan(const std::string_view name)
+    : m_Enabled(trace_enabled)
+{
+    if (!m_Enabled)
+        return;
+
+    m_Name  = name;
+    m_Begin = std::chrono::steady_clock::now();
+}
+
+mcc::TraceSpan::~TraceSpan()
+{
+    if (!m_Enabled)
+        return;
+
+    const auto end = std::chrono::steady_clock::now();
+
+    TraceEvent event{
+        .Name     = std::move(m_Name),
+        .Args     = std::move(m_Args),
+        .Begin    = microseconds(m_Begin - trace_begin),
+        .Duration = microseconds(end - m_Begin),
+        .Thread   = trace_thread(),
+    };
+
+    std::lock_guard lock(trace_mutex);
+    trace_events.push_back(std::move(event));
+}
+
+mcc::TraceSpan::operator bool() const
+{
+    return m_Enabled;
+}
+
+mcc::TraceSpan &mcc::TraceSpan::Arg(
+        const std::string_view key,
+        const std::uint64_t value)
+{
+    if (!m_Enabled)
+        return *this;
+
+    if (!m_Args.empty())
+        m_Args += ',';
+    m_Args += '"';
+    escape(m_Args, key);
+    std::format_to(std::back_inserter(m_Args), "\":{}", value);
+    return *this;
+}
+
+mcc::TraceSpan &mcc::TraceSpan::Arg(
+        const std::string_view key,
+        const std::string_view value)
+{
+    if (!m_Enabled)
+        return *this;
+
+    if (!m_Args.empty())
+        m_Args += ',';
+    m_Args += '"';
+    escape(m_Args, key);
+    m_Args += "\":\"";
+    escape(m_Args, value);
+    m_Args += '"';
+    return *this;
+}
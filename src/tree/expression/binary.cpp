@@ -80,7 +80,7 @@ mcc::ExpressionPtr mcc::BinaryExpression::Merge()
         return nullptr;
     }
 
-    return std::make_unique<VectorExpression>(Where, Operator, std::move(operands));
+    return MakeNode<VectorExpression>(Where, Operator, std::move(operands));
 }
 
 std::ostream &mcc::BinaryExpression::Print(std::ostream &stream) const
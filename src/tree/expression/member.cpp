@@ -28,7 +28,7 @@ mcc::ValuePtr mcc::MemberExpression::GenerateValue(
     Assert(object->Type->IsObject(), Object->Where, "object must be of type object, but is {}", object->Type);
 
     if (const auto constant_object = std::dynamic_pointer_cast<ConstantObject>(object))
-        return constant_object->Values.at(Member);
+        return constant_object->Values.at(Member).Get();
 
     if (const auto argument_object = std::dynamic_pointer_cast<ArgumentValue>(object))
     {
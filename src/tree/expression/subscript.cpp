@@ -36,7 +36,7 @@ mcc::ValuePtr mcc::SubscriptExpression::GenerateValue(
     if (const auto constant_base = std::dynamic_pointer_cast<ConstantArray>(base))
     {
         if (const auto constant_index = std::dynamic_pointer_cast<ConstantNumber>(index))
-            return constant_base->Values[constant_index->Value];
+            return constant_base->Values[constant_index->Value].Get();
 
         base = builder.Allocate(Base->Where, {}, base->Type, false);
         (void) builder.CreateStore(Base->Where, {}, base, constant_base, true);
@@ -11,7 +11,7 @@ mcc::MultiStatement::MultiStatement(
 
 std::ostream &mcc::MultiStatement::Print(std::ostream &stream) const
 {
-    static std::string indentation;
+    static thread_local std::string indentation;
 
     stream << '{' << std::endl;
     indentation.append(2, ' ');
@@ -76,13 +76,15 @@ void mcc::DefineNode::Generate(Builder &builder) const
         if (tag_namespace_.empty())
             tag_namespace_ = builder.GetNamespace();
 
-        auto &[replace_, tags_] = builder.GetPackage().Tags[tag_namespace_][tag_path_];
-        tags_.emplace_back(function->Mangle());
+        auto &[replace_, tags_] = builder.GetPackage().Tags[ResourceTable::Intern({ tag_namespace_, tag_path_ })];
+        tags_.emplace_back(function->GetMangledId());
     }
 
     if (!Body)
         return;
 
+    Assert(function->Blocks.empty(), Where, "function {} is already implemented", Location);
+
     const auto entry_target = Block::Create(Body->Where, "entry", builder.GetContext(), function);
     builder.SetInsertBlock(entry_target);
 
@@ -1,10 +1,61 @@
 #include <mcc/builder.hpp>
 #include <mcc/error.hpp>
 #include <mcc/parse.hpp>
+#include <mcc/source.hpp>
 #include <mcc/statement.hpp>
 #include <mcc/tree.hpp>
+#include <mcc/type.hpp>
 
-#include <fstream>
+#include <algorithm>
+
+static void generate_include(
+        mcc::Builder &builder,
+        const mcc::SourceLocation &where,
+        const std::filesystem::path &filepath,
+        const std::filesystem::path &canonical_path,
+        std::set<std::filesystem::path> &include_chain)
+{
+    builder.AddDependency(canonical_path);
+
+    auto &context  = builder.GetContext();
+    auto &includes = builder.GetIncludes();
+    if (const auto nodes = includes.Find(canonical_path, context))
+    {
+        for (auto &node : *nodes)
+            node->GenerateInclude(builder, include_chain);
+        return;
+    }
+
+    const mcc::SourceBuffer source(filepath);
+    mcc::Assert(source.IsOpen(), where, "failed to open file {}", filepath.string());
+
+    const auto visible = context.GetNamedTypes();
+    const auto arena   = std::make_shared<mcc::Arena>();
+    std::vector<mcc::TreeNodePtr> nodes;
+
+    mcc::Parser parser(context, source.View(), filepath.string());
+    while (parser)
+    {
+        mcc::TreeNodePtr statement;
+        {
+            const mcc::ArenaScope scope(arena);
+            statement = parser();
+        }
+
+        if (statement)
+        {
+            statement->GenerateInclude(builder, include_chain);
+            nodes.emplace_back(std::move(statement));
+        }
+    }
+
+    std::map<std::string, mcc::TypePtr> imports;
+    for (auto &[name_, type_] : parser.GetNamedLookups())
+        if (const auto it = visible.find(name_); it != visible.end() && it->second == type_)
+            imports.emplace(name_, type_);
+
+    includes.Insert(canonical_path, std::move(imports), arena, std::move(nodes));
+}
 
 mcc::IncludeNode::IncludeNode(
         const SourceLocation &where,
@@ -21,36 +72,57 @@ std::ostream &mcc::IncludeNode::Print(std::ostream &stream) const
 
 void mcc::IncludeNode::Generate(Builder &builder) const
 {
-    std::ifstream stream(Filepath);
-    Assert(stream.is_open(), Where, "failed to open file {}", Filepath.string());
+    const auto canonical_path = weakly_canonical(Filepath);
 
     std::set<std::filesystem::path> include_chain;
-    include_chain.insert(std::filesystem::canonical(Where.Filename));
-    include_chain.insert(canonical(Filepath));
+    include_chain.insert(FileTable::GetCanonical(Where.File));
+    include_chain.insert(canonical_path);
 
-    Parser parser(builder.GetContext(), stream, Filepath.string());
-    while (parser)
-        if (const auto statement = parser())
-            statement->GenerateInclude(builder, include_chain);
+    generate_include(builder, Where, Filepath, canonical_path, include_chain);
 }
 
 void mcc::IncludeNode::GenerateInclude(
         Builder &builder,
         std::set<std::filesystem::path> &include_chain) const
 {
-    if (include_chain.contains(canonical(Filepath)))
+    const auto canonical_path = weakly_canonical(Filepath);
+    if (include_chain.contains(canonical_path))
     {
         Warning(Where, "recursive include chain detected!");
         return;
     }
 
-    std::ifstream stream(Filepath);
-    Assert(stream.is_open(), Where, "failed to open file {}", Filepath.string());
+    include_chain.insert(canonical_path);
 
-    include_chain.insert(canonical(Filepath));
+    generate_include(builder, Where, Filepath, canonical_path, include_chain);
+}
 
-    Parser parser(builder.GetContext(), stream, Filepath.string());
-    while (parser)
-        if (const auto statement = parser())
-            statement->GenerateInclude(builder, include_chain);
+const std::vector<mcc::TreeNodePtr> *mcc::IncludeCache::Find(
+        const std::filesystem::path &path,
+        const Context &context) const
+{
+    const auto it = m_Entries.find(path);
+    if (it == m_Entries.end())
+        return nullptr;
+
+    for (auto &[imports_, arena_, nodes_] : it->second)
+        if (std::ranges::all_of(
+                    imports_,
+                    [&context](const auto &import) { return context.GetNamed(import.first) == import.second; }))
+            return &nodes_;
+    return nullptr;
+}
+
+void mcc::IncludeCache::Insert(
+        const std::filesystem::path &path,
+        std::map<std::string, TypePtr> imports,
+        std::shared_ptr<Arena> arena,
+        std::vector<TreeNodePtr> nodes)
+{
+    m_Entries[path].push_back({ std::move(imports), std::move(arena), std::move(nodes) });
+}
+
+void mcc::IncludeCache::Erase(const std::filesystem::path &path)
+{
+    m_Entries.erase(path);
 }
@@ -0,0 +1,30 @@
+#include <mcc/builder.hpp>
+#include <mcc/tree.hpp>
+#include <mcc/type.hpp>
+
+mcc::TypeNode::TypeNode(
+        const SourceLocation &where,
+        std::string name,
+        TypePtr type)
+    : TreeNode(where),
+      Name(std::move(name)),
+      Type(std::move(type))
+{
+}
+
+std::ostream &mcc::TypeNode::Print(std::ostream &stream) const
+{
+    return stream << "type " << Name << " = " << Type;
+}
+
+void mcc::TypeNode::Generate(Builder &builder) const
+{
+    builder.GetContext().SetNamed(Name, Type);
+}
+
+void mcc::TypeNode::GenerateInclude(
+        Builder &builder,
+        std::set<std::filesystem::path> &include_chain) const
+{
+    builder.GetContext().SetNamed(Name, Type);
+}
@@ -11,7 +11,7 @@ bool mcc::SameOrSpecialization(
     if (a == b)
         return true;
 
-    return b->HasSpecialization(a);
+    return b->Types.HasSpecialization(b, a);
 }
 
 mcc::Type::Type(Context &context)
@@ -1,43 +1,63 @@
 #include <mcc/type.hpp>
 
+template<typename T, typename... Args>
+mcc::TypePtr mcc::Context::Create(Args &&... args)
+{
+    auto type  = std::make_shared<T>(*this, std::forward<Args>(args)...);
+    type->Self = type;
+    type->Id   = m_NextId++;
+    return type;
+}
+
+static size_t combine(
+        const size_t hash,
+        const size_t value)
+{
+    return hash ^ (value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2));
+}
+
+size_t mcc::TypeKeyHash::operator()(const std::vector<TypeId> &key) const
+{
+    auto hash = key.size();
+    for (auto id : key)
+        hash = combine(hash, id);
+    return hash;
+}
+
+size_t mcc::TypeKeyHash::operator()(const std::vector<std::pair<std::string, TypeId>> &key) const
+{
+    auto hash = key.size();
+    for (auto &[name_, id_] : key)
+        hash = combine(combine(hash, std::hash<std::string>()(name_)), id_);
+    return hash;
+}
+
 mcc::TypePtr mcc::Context::GetVoid()
 {
     if (!m_Void)
-    {
-        m_Void       = std::make_shared<VoidType>(*this);
-        m_Void->Self = m_Void;
-    }
+        m_Void = Create<VoidType>();
     return m_Void;
 }
 
 mcc::TypePtr mcc::Context::GetNumber()
 {
     if (!m_Number)
-    {
-        m_Number       = std::make_shared<NumberType>(*this);
-        m_Number->Self = m_Number;
-    }
+        m_Number = Create<NumberType>();
     return m_Number;
 }
 
 mcc::TypePtr mcc::Context::GetString()
 {
     if (!m_String)
-    {
-        m_String       = std::make_shared<StringType>(*this);
-        m_String->Self = m_String;
-    }
+        m_String = Create<StringType>();
     return m_String;
 }
 
 mcc::TypePtr mcc::Context::GetArray(const TypePtr &elements)
 {
-    auto &type = m_Array[elements];
+    auto &type = m_Array[elements->Id];
     if (!type)
-    {
-        type       = std::make_shared<ArrayType>(*this, elements);
-        type->Self = type;
-    }
+        type = Create<ArrayType>(elements);
     return type;
 }
 
@@ -47,34 +67,40 @@ mcc::TypePtr mcc::Context::GetObject(
                 TypePtr
         > &elements)
 {
-    auto &type = m_Struct[elements];
+    std::vector<std::pair<std::string, TypeId>> key;
+    key.reserve(elements.size());
+    for (auto &[name_, element_] : elements)
+        key.emplace_back(name_, element_->Id);
+
+    auto &type = m_Struct[std::move(key)];
     if (!type)
-    {
-        type       = std::make_shared<ObjectType>(*this, elements);
-        type->Self = type;
-    }
+        type = Create<ObjectType>(elements);
     return type;
 }
 
 mcc::TypePtr mcc::Context::GetTuple(const std::vector<TypePtr> &elements)
 {
-    auto &type = m_Tuple[elements];
+    std::vector<TypeId> key;
+    key.reserve(elements.size());
+    for (auto &element : elements)
+        key.push_back(element->Id);
+
+    auto &type = m_Tuple[std::move(key)];
     if (!type)
-    {
-        type       = std::make_shared<TupleType>(*this, elements);
-        type->Self = type;
-    }
+        type = Create<TupleType>(elements);
     return type;
 }
 
 mcc::TypePtr mcc::Context::GetUnion(const std::set<TypePtr> &elements)
 {
-    auto &type = m_Union[elements];
+    std::vector<TypeId> key;
+    key.reserve(elements.size());
+    for (auto &element : elements)
+        key.push_back(element->Id);
+
+    auto &type = m_Union[std::move(key)];
     if (!type)
-    {
-        type       = std::make_shared<UnionType>(*this, elements);
-        type->Self = type;
-    }
+        type = Create<UnionType>(elements);
     return type;
 }
 
@@ -83,42 +109,37 @@ mcc::TypePtr mcc::Context::GetFunction(
         const TypePtr &result,
         bool throws)
 {
-    auto &type = m_Function[parameters][result][throws];
+    std::vector<TypeId> key;
+    key.reserve(parameters.size() + 2);
+    for (auto &parameter : parameters)
+        key.push_back(parameter->Id);
+    key.push_back(result->Id);
+    key.push_back(throws);
+
+    auto &type = m_Function[std::move(key)];
     if (!type)
-    {
-        type       = std::make_shared<FunctionType>(*this, parameters, result, throws);
-        type->Self = type;
-    }
+        type = Create<FunctionType>(parameters, result, throws);
     return type;
 }
 
 mcc::TypePtr mcc::Context::GetAnyArray()
 {
     if (!m_AnyArray)
-    {
-        m_AnyArray       = std::make_shared<AnyArrayType>(*this);
-        m_AnyArray->Self = m_AnyArray;
-    }
+        m_AnyArray = Create<AnyArrayType>();
     return m_AnyArray;
 }
 
 mcc::TypePtr mcc::Context::GetAnyObject()
 {
     if (!m_AnyObject)
-    {
-        m_AnyObject       = std::make_shared<AnyObjectType>(*this);
-        m_AnyObject->Self = m_AnyObject;
-    }
+        m_AnyObject = Create<AnyObjectType>();
     return m_AnyObject;
 }
 
 mcc::TypePtr mcc::Context::GetAnyFunction()
 {
     if (!m_AnyFunction)
-    {
-        m_AnyFunction       = std::make_shared<AnyFunctionType>(*this);
-        m_AnyFunction->Self = m_AnyFunction;
-    }
+        m_AnyFunction = Create<AnyFunctionType>();
     return m_AnyFunction;
 }
 
@@ -136,9 +157,37 @@ mcc::TypePtr mcc::Context::SetNamed(
     return pre;
 }
 
+const std::map<std::string, mcc::TypePtr> &mcc::Context::GetNamedTypes() const
+{
+    return m_Named;
+}
+
 mcc::TypePtr mcc::Context::GetNamed(const std::string &name) const
 {
     if (m_Named.contains(name))
         return m_Named.at(name);
     return nullptr;
 }
+
+void mcc::Context::ClearNamed()
+{
+    m_Named.clear();
+}
+
+mcc::SymbolTable &mcc::Context::GetSymbols()
+{
+    return m_Symbols;
+}
+
+bool mcc::Context::HasSpecialization(
+        const TypePtr &type,
+        const TypePtr &other)
+{
+    const auto key = static_cast<std::uint64_t>(type->Id) << 32 | other->Id;
+    if (const auto it = m_Specializations.find(key); it != m_Specializations.end())
+        return it->second;
+
+    const auto result = type->HasSpecialization(other);
+    m_Specializations.emplace(key, result);
+    return result;
+}
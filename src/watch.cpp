@@ -0,0 +1,131 @@
+#include <mcc/error.hpp>
+#include <mcc/watch.hpp>
+
+#include <chrono>
+#include <ranges>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// events within this window are reported together
+static constexpr auto settle_time = std::chrono::milliseconds(50);
+
+#ifdef __linux__
+
+mcc::Watcher::Watcher(std::filesystem::path root)
+    : m_Root(std::move(root)),
+      m_Descriptor(inotify_init1(IN_CLOEXEC))
+{
+    Assert(m_Descriptor >= 0, "failed to initialize inotify");
+
+    Add(m_Root);
+    for (auto &entry : std::filesystem::recursive_directory_iterator(m_Root))
+        if (entry.is_directory())
+            Add(entry.path());
+}
+
+mcc::Watcher::~Watcher()
+{
+    close(m_Descriptor);
+}
+
+std::set<std::filesystem::path> mcc::Watcher::Wait()
+{
+    std::set<std::filesystem::path> changed;
+
+    alignas(inotify_event) char buffer[4096];
+
+    for (auto timeout = -1;; timeout = static_cast<int>(settle_time.count()))
+    {
+        pollfd descriptor{ .fd = m_Descriptor, .events = POLLIN };
+        if (poll(&descriptor, 1, timeout) <= 0)
+        {
+            if (!changed.empty())
+                return changed;
+            continue;
+        }
+
+        const auto length = read(m_Descriptor, buffer, sizeof(buffer));
+        Assert(length > 0, "failed to read inotify events");
+
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const auto event = reinterpret_cast<const inotify_event *>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (!event->len || !m_Directories.contains(event->wd))
+                continue;
+
+            const auto path = m_Directories.at(event->wd) / event->name;
+            if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)))
+            {
+                Add(path);
+                for (auto &entry : std::filesystem::recursive_directory_iterator(path))
+                    if (entry.is_directory())
+                        Add(entry.path());
+                    else
+                        changed.insert(entry.path());
+                continue;
+            }
+
+            changed.insert(path);
+        }
+    }
+}
+
+void mcc::Watcher::Add(const std::filesystem::path &directory)
+{
+    const auto watch = inotify_add_watch(
+            m_Descriptor,
+            directory.c_str(),
+            IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+    Assert(watch >= 0, "failed to watch directory {}", directory.string());
+
+    m_Directories[watch] = directory;
+}
+
+#else
+
+mcc::Watcher::Watcher(std::filesystem::path root)
+    : m_Root(std::move(root))
+{
+    Add(m_Root);
+}
+
+mcc::Watcher::~Watcher() = default;
+
+std::set<std::filesystem::path> mcc::Watcher::Wait()
+{
+    for (;;)
+    {
+        std::this_thread::sleep_for(settle_time * 4);
+
+        auto previous = std::move(m_Times);
+        m_Times.clear();
+        Add(m_Root);
+
+        std::set<std::filesystem::path> changed;
+        for (auto &[path_, time_] : m_Times)
+            if (const auto it = previous.find(path_); it == previous.end() || it->second != time_)
+                changed.insert(path_);
+        for (auto &path_ : previous | std::views::keys)
+            if (!m_Times.contains(path_))
+                changed.insert(path_);
+
+        if (!changed.empty())
+            return changed;
+    }
+}
+
+void mcc::Watcher::Add(const std::filesystem::path &directory)
+{
+    for (auto &entry : std::filesystem::recursive_directory_iterator(directory))
+        if (entry.is_regular_file())
+            m_Times[entry.path()] = entry.last_write_time();
+}
+
+#endif
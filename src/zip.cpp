@@ -0,0 +1,212 @@
+#include <mcc/error.hpp>
+#include <mcc/zip.hpp>
+
+#include <limits>
+
+#include <zlib.h>
+
+static constexpr std::uint32_t local_header_signature   = 0x04034b50;
+static constexpr std::uint32_t central_header_signature = 0x02014b50;
+static constexpr std::uint32_t end_signature            = 0x06054b50;
+static constexpr std::uint32_t zip64_end_signature      = 0x06064b50;
+static constexpr std::uint32_t zip64_locator_signature  = 0x07064b50;
+
+static constexpr std::uint16_t zip_version   = 20;
+static constexpr std::uint16_t zip64_version = 45;
+static constexpr std::uint16_t zip64_extra   = 0x0001;
+static constexpr std::uint16_t utf8_flag   = 1 << 11;
+
+// fixed, for reproducible archives
+static constexpr std::uint16_t dos_time = 0;
+static constexpr std::uint16_t dos_date = 1 << 5 | 1;
+
+static void put16(
+        std::string &buffer,
+        const std::uint16_t value)
+{
+    buffer += static_cast<char>(value & 0xff);
+    buffer += static_cast<char>(value >> 8 & 0xff);
+}
+
+static void put32(
+        std::string &buffer,
+        const std::uint32_t value)
+{
+    put16(buffer, static_cast<std::uint16_t>(value & 0xffff));
+    put16(buffer, static_cast<std::uint16_t>(value >> 16));
+}
+
+static void put64(
+        std::string &buffer,
+        const std::uint64_t value)
+{
+    put32(buffer, static_cast<std::uint32_t>(value & 0xffffffff));
+    put32(buffer, static_cast<std::uint32_t>(value >> 32));
+}
+
+static std::string deflate(const std::string &content)
+{
+    z_stream stream{};
+    mcc::Assert(
+            deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK,
+            "failed to initialize deflate stream");
+
+    std::string data(deflateBound(&stream, static_cast<uLong>(content.size())), '\0');
+
+    stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(content.data()));
+    stream.avail_in  = static_cast<uInt>(content.size());
+    stream.next_out  = reinterpret_cast<Bytef *>(data.data());
+    stream.avail_out = static_cast<uInt>(data.size());
+
+    const auto result = ::deflate(&stream, Z_FINISH);
+    data.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    mcc::Assert(result == Z_STREAM_END, "failed to deflate zip entry");
+    return data;
+}
+
+mcc::ZipEntry mcc::ZipEntry::Compress(
+        std::string name,
+        const std::string &content,
+        const ZipMethod_ method)
+{
+    Assert(content.size() < std::numeric_limits<std::uint32_t>::max(), "zip entry {} is too large", name);
+
+    const auto crc = crc32(0, reinterpret_cast<const Bytef *>(content.data()), static_cast<uInt>(content.size()));
+
+    ZipEntry entry{
+        .Name   = std::move(name),
+        .Method = ZipMethod_::Store,
+        .Crc    = static_cast<std::uint32_t>(crc),
+        .Size   = static_cast<std::uint32_t>(content.size()),
+    };
+
+    if (method == ZipMethod_::Deflate)
+        if (auto data = deflate(content); data.size() < content.size())
+        {
+            entry.Method = ZipMethod_::Deflate;
+            entry.Data   = std::move(data);
+            return entry;
+        }
+
+    entry.Data = content;
+    return entry;
+}
+
+mcc::ZipWriter::ZipWriter(const std::filesystem::path &path)
+    : m_Path(path),
+      m_Stream(path, std::ios::binary)
+{
+    Assert(m_Stream.is_open(), "failed to open file {}", path.string());
+}
+
+void mcc::ZipWriter::Add(const ZipEntry &entry)
+{
+    const Record record{
+        .Name           = entry.Name,
+        .Method         = entry.Method,
+        .Crc            = entry.Crc,
+        .CompressedSize = static_cast<std::uint32_t>(entry.Data.size()),
+        .Size           = entry.Size,
+        .Offset         = m_Offset,
+    };
+
+    std::string header;
+    put32(header, local_header_signature);
+    put16(header, zip_version);
+    put16(header, utf8_flag);
+    put16(header, static_cast<std::uint16_t>(record.Method));
+    put16(header, dos_time);
+    put16(header, dos_date);
+    put32(header, record.Crc);
+    put32(header, record.CompressedSize);
+    put32(header, record.Size);
+    put16(header, static_cast<std::uint16_t>(record.Name.size()));
+    put16(header, 0);
+    header += record.Name;
+
+    m_Stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+    m_Stream.write(entry.Data.data(), static_cast<std::streamsize>(entry.Data.size()));
+    Assert(!!m_Stream, "failed to write file {}", m_Path.string());
+
+    m_Offset += header.size() + entry.Data.size();
+    m_Records.push_back(record);
+}
+
+void mcc::ZipWriter::Finish()
+{
+    constexpr auto max16 = std::numeric_limits<std::uint16_t>::max();
+    constexpr auto max32 = std::numeric_limits<std::uint32_t>::max();
+
+    std::string directory;
+    for (auto &[name_, method_, crc_, compressed_size_, size_, offset_] : m_Records)
+    {
+        const auto zip64 = offset_ >= max32;
+
+        put32(directory, central_header_signature);
+        put16(directory, zip64 ? zip64_version : zip_version);
+        put16(directory, zip64 ? zip64_version : zip_version);
+        put16(directory, utf8_flag);
+        put16(directory, static_cast<std::uint16_t>(method_));
+        put16(directory, dos_time);
+        put16(directory, dos_date);
+        put32(directory, crc_);
+        put32(directory, compressed_size_);
+        put32(directory, size_);
+        put16(directory, static_cast<std::uint16_t>(name_.size()));
+        put16(directory, zip64 ? 12 : 0);
+        put16(directory, 0);
+        put16(directory, 0);
+        put16(directory, 0);
+        put32(directory, 0);
+        put32(directory, zip64 ? max32 : static_cast<std::uint32_t>(offset_));
+        directory += name_;
+
+        if (zip64)
+        {
+            put16(directory, zip64_extra);
+            put16(directory, 8);
+            put64(directory, offset_);
+        }
+    }
+
+    const auto directory_offset = m_Offset;
+    const auto directory_size   = static_cast<std::uint64_t>(directory.size());
+    const auto count            = static_cast<std::uint64_t>(m_Records.size());
+
+    const auto zip64 = count >= max16 || directory_offset >= max32 || directory_size >= max32;
+    if (zip64)
+    {
+        const auto end_offset = directory_offset + directory_size;
+
+        put32(directory, zip64_end_signature);
+        put64(directory, 44);
+        put16(directory, zip64_version);
+        put16(directory, zip64_version);
+        put32(directory, 0);
+        put32(directory, 0);
+        put64(directory, count);
+        put64(directory, count);
+        put64(directory, directory_size);
+        put64(directory, directory_offset);
+
+        put32(directory, zip64_locator_signature);
+        put32(directory, 0);
+        put64(directory, end_offset);
+        put32(directory, 1);
+    }
+
+    put32(directory, end_signature);
+    put16(directory, 0);
+    put16(directory, 0);
+    put16(directory, zip64 ? max16 : static_cast<std::uint16_t>(count));
+    put16(directory, zip64 ? max16 : static_cast<std::uint16_t>(count));
+    put32(directory, zip64 ? max32 : static_cast<std::uint32_t>(directory_size));
+    put32(directory, zip64 ? max32 : static_cast<std::uint32_t>(directory_offset));
+    put16(directory, 0);
+
+    m_Stream.write(directory.data(), static_cast<std::streamsize>(directory.size()));
+    m_Stream.close();
+    Assert(!m_Stream.fail(), "failed to write file {}", m_Path.string());
+}